@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Release
+cl /nologo /Zi /O2 /DNDEBUG /MD /EHsc /I ..\.. %* main.cpp ..\..\imgui.cpp ..\..\imgui_demo.cpp ..\..\imgui_draw.cpp ..\..\imgui_widgets.cpp /FeRelease/example_null_benchmark.exe /FoRelease/ /link gdi32.lib shell32.lib
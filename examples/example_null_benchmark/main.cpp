@@ -0,0 +1,902 @@
+// dear imgui: null/dummy example application, benchmark suite
+// (compile and link imgui, run a set of standard scenes headless with NO GRAPHICS OUTPUT, report timings and draw data statistics)
+// This is used to compare the performance of different builds/configurations of imgui on a reproducible set of workloads.
+// Usage: example_null_benchmark [--frames N] [--warmup N] [--scene FILTER] [--json FILE] [--cjk-font FILE.ttf] [--trace PREFIX] [--replay FILE] [--list]
+#include "imgui.h"
+#include "imgui_internal.h"     // ImHashStr, ImGuiHashStorage, FindWindowSettings, ItemSize/ItemAdd
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+static double GetTimeNs()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Counting allocator, to report the number of allocations made by each frame
+static int      g_AllocCount = 0;
+static size_t   g_AllocBytes = 0;
+static void*    CountingAlloc(size_t size, void* user_data)   { IM_UNUSED(user_data); g_AllocCount++; g_AllocBytes += size; return malloc(size); }
+static void     CountingFree(void* ptr, void* user_data)      { IM_UNUSED(user_data); free(ptr); }
+
+// Deterministic pseudo-random numbers, so every run submits the same content
+static ImU32    g_RandomState = 0x12345678;
+static ImU32    Random()                                      { g_RandomState ^= g_RandomState << 13; g_RandomState ^= g_RandomState >> 17; g_RandomState ^= g_RandomState << 5; return g_RandomState; }
+
+// Prevent the compiler from discarding the result of micro benchmarks
+static volatile ImU32 g_Sink = 0;
+
+// One result = a name and a flat list of named values, printed to the console and written to the .json file
+struct BenchResult
+{
+    std::string                                     Name;
+    std::vector<std::pair<std::string, double> >    Values;
+    bool                                            Failed;     // A sanity check failed, the values are not meaningful
+    BenchResult()                                   { Failed = false; }
+    void Add(const char* name, double value)        { Values.push_back(std::make_pair(std::string(name), value)); }
+    void Check(bool cond, const char* desc)         { if (!cond) { fprintf(stderr, "%s: check failed: %s\n", Name.c_str(), desc); Failed = true; } }   // Unlike IM_ASSERT(), not compiled out by NDEBUG
+};
+
+struct BenchSettings
+{
+    int             Frames;
+    int             WarmupFrames;
+    const char*     Filter;
+    const char*     JsonFilename;
+    const char*     CjkFontFilename;
+    const char*     TracePrefix;
+    const char*     ReplayFilename;
+    bool            ListOnly;
+    ImFontAtlas*    FontAtlas;
+    BenchSettings() { Frames = 100; WarmupFrames = 10; Filter = JsonFilename = CjkFontFilename = TracePrefix = ReplayFilename = NULL; ListOnly = false; FontAtlas = NULL; }
+};
+
+//-----------------------------------------------------------------------------
+// Frame scenes: submit the same content every frame, measure NewFrame()..Render()
+//-----------------------------------------------------------------------------
+
+struct FrameScene
+{
+    const char*     Name;
+    const char*     Desc;
+    void            (*Setup)();             // Called once after creating the context (optional)
+    void            (*Submit)(int frame);   // Called every frame between NewFrame() and Render()
+    void            (*Teardown)();          // Called once before destroying the context (optional)
+    bool            MoveMouse;              // Sweep the mouse across the screen, to exercise hovering
+    int             ItemsCount;             // Number of items submitted per frame, to report the cost per item (optional)
+};
+
+static void BeginFullscreenWindow(const char* name)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Once);
+    ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+}
+
+static void SceneDemo(int frame)
+{
+    IM_UNUSED(frame);
+    ImGui::ShowDemoWindow();
+}
+
+static void SceneText10k(int frame)
+{
+    BeginFullscreenWindow("Text");
+    for (int n = 0; n < 10000; n++)
+        ImGui::Text("Line %d, frame %d: the quick brown fox jumps over the lazy dog", n, frame);
+    ImGui::End();
+}
+
+static void SceneButtons5k(int frame)
+{
+    IM_UNUSED(frame);
+    BeginFullscreenWindow("Buttons");
+    for (int n = 0; n < 5000; n++)
+    {
+        ImGui::PushID(n);
+        if (n % 20 != 0)
+            ImGui::SameLine();
+        ImGui::Button("Button");
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+static void SceneButtons5kRoundedSetup()
+{
+    ImGuiStyle& style = ImGui::GetStyle();
+    style.FrameRounding = 4.0f;
+    style.FrameBorderSize = 1.0f;
+}
+
+static void SceneWindows1k(int frame)
+{
+    for (int n = 0; n < 1000; n++)
+    {
+        ImGui::SetNextWindowPos(ImVec2((float)((n * 37) % 1800), (float)((n * 53) % 1000)), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(120.0f, 80.0f), ImGuiCond_Once);
+        char title[32];
+        sprintf(title, "Window %d", n);
+        ImGui::Begin(title, NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Frame %d", frame);
+        ImGui::End();
+    }
+}
+
+static void SubmitTreeNode(int depth, int* counter)
+{
+    for (int n = 0; n < 10; n++)
+    {
+        (*counter)++;
+        if (depth == 4)
+        {
+            ImGui::TreeNodeEx((void*)(intptr_t)n, ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen, "Leaf %d", n);
+            continue;
+        }
+        if (ImGui::TreeNodeEx((void*)(intptr_t)n, ImGuiTreeNodeFlags_DefaultOpen, "Node %d (depth %d)", n, depth))
+        {
+            SubmitTreeNode(depth + 1, counter);
+            ImGui::TreePop();
+        }
+    }
+}
+
+static void SceneTree100k(int frame)
+{
+    IM_UNUSED(frame);
+    BeginFullscreenWindow("Tree");
+    int counter = 0;
+    SubmitTreeNode(0, &counter);    // 10 + 100 + 1000 + 10000 + 100000 nodes, all open
+    ImGui::End();
+}
+
+static char* g_LargeText = NULL;
+static const size_t g_LargeTextSize = 1024 * 1024;
+static void SceneInputTextLargeSetup()
+{
+    g_LargeText = (char*)malloc(g_LargeTextSize);
+    char* p = g_LargeText;
+    for (int n = 0; n < 10000; n++)
+        p += sprintf(p, "%05d: Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n", n);
+}
+static void SceneInputTextLargeTeardown()
+{
+    free(g_LargeText);
+    g_LargeText = NULL;
+}
+static void SceneInputTextLarge(int frame)
+{
+    BeginFullscreenWindow("InputText");
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", g_LargeText, g_LargeTextSize, ImVec2(-FLT_MIN, -FLT_MIN));
+    ImGui::End();
+}
+
+static void SceneCustomDraw(int frame)
+{
+    BeginFullscreenWindow("CustomDraw");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    ImVec2 points[200];
+    for (int line_n = 0; line_n < 200; line_n++)
+    {
+        for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+            points[n] = ImVec2(10.0f + n * 9.5f, 20.0f + line_n * 5.0f + ImSin((n + frame) * 0.1f + line_n) * 20.0f);
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(255, 128 + line_n % 128, 0, 255), false, 1.0f + (line_n % 4));
+    }
+    for (int n = 0; n < 1000; n++)
+    {
+        ImVec2 center((float)(50 + (n * 37) % 1800), (float)(50 + (n * 53) % 1000));
+        if (n & 1)
+            draw_list->AddCircleFilled(center, 10.0f + (n % 20), IM_COL32(0, 128, 255, 128), 24);
+        else
+            draw_list->AddCircle(center, 10.0f + (n % 20), IM_COL32(255, 255, 255, 255), 24, 2.0f);
+    }
+    ImGui::End();
+}
+
+static void SceneCjkText(int frame)
+{
+    BeginFullscreenWindow("CJK");
+    // "日本語の文章を表示するテスト、中文文本渲染性能测试。" (use --cjk-font to load the glyphs, otherwise they are rendered as the fallback character)
+    const char* text = "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe6\x96\x87\xe7\xab\xa0\xe3\x82\x92\xe8\xa1\xa8\xe7\xa4\xba\xe3\x81\x99\xe3\x82\x8b\xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88\xe3\x80\x81"
+                       "\xe4\xb8\xad\xe6\x96\x87\xe6\x96\x87\xe6\x9c\xac\xe6\xb8\xb2\xe6\x9f\x93\xe6\x80\xa7\xe8\x83\xbd\xe6\xb5\x8b\xe8\xaf\x95\xe3\x80\x82";
+    for (int n = 0; n < 60; n++)
+        ImGui::Text("%d %s %s %d", n, text, text, frame);
+    ImGui::End();
+}
+
+// 100 panels with mostly static content (or changing every frame), submitted with or without a content hash
+static void SubmitPanels(int frame, bool use_content_hash, bool all_changing = false)
+{
+    for (int n = 0; n < 100; n++)
+    {
+        ImGui::SetNextWindowPos(ImVec2((float)((n % 10) * 190), (float)((n / 10) * 105)), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(185.0f, 100.0f), ImGuiCond_Once);
+        const int value = (n == 0 || all_changing) ? frame + n : n;    // Only the first panel changes every frame, unless all_changing
+        if (use_content_hash)
+            ImGui::SetNextWindowContentHash(ImHashData(&value, sizeof(value)));
+        char title[32];
+        sprintf(title, "Panel %d", n);
+        if (ImGui::Begin(title, NULL, ImGuiWindowFlags_NoSavedSettings))
+        {
+            for (int line_n = 0; line_n < 4; line_n++)
+                ImGui::Text("Value %d, line %d", value, line_n);
+            ImGui::ProgressBar((value % 100) / 100.0f);
+        }
+        ImGui::End();
+    }
+}
+static void ScenePanelsUncached(int frame)  { SubmitPanels(frame, false); }
+static void ScenePanelsCached(int frame)    { SubmitPanels(frame, true); }
+static void ScenePanelsChangingCached(int frame) { SubmitPanels(frame, true, true); }
+
+// Fill 4 draw lists from worker threads, then append them to a window draw list
+static const int g_DetachedListsCount = 4;
+static ImDrawList* g_DetachedLists[g_DetachedListsCount] = {};
+static void SceneDetachedDrawListsSetup()
+{
+    for (int n = 0; n < g_DetachedListsCount; n++)
+        g_DetachedLists[n] = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+}
+static void SceneDetachedDrawListsTeardown()
+{
+    for (int n = 0; n < g_DetachedListsCount; n++)
+        IM_DELETE(g_DetachedLists[n]);
+}
+static void FillDetachedDrawList(ImDrawList* draw_list, int list_n, int frame)
+{
+    for (int n = 0; n < 2500; n++)
+    {
+        ImVec2 p((float)((n * 37 + list_n * 450) % 1800), (float)((n * 53 + frame) % 1000));
+        draw_list->AddRectFilled(p, ImVec2(p.x + 8.0f, p.y + 8.0f), IM_COL32(list_n * 60, 255 - list_n * 60, 128, 255));
+        draw_list->AddLine(p, ImVec2(p.x + 20.0f, p.y + 10.0f), IM_COL32_WHITE, 1.0f);
+    }
+}
+static void SceneDetachedDrawLists(int frame)
+{
+    BeginFullscreenWindow("Detached");
+    for (int n = 0; n < g_DetachedListsCount; n++)
+        ImGui::SetupDetachedDrawList(g_DetachedLists[n]);
+    std::thread threads[g_DetachedListsCount];
+    for (int n = 0; n < g_DetachedListsCount; n++)
+        threads[n] = std::thread(FillDetachedDrawList, g_DetachedLists[n], n, frame);
+    for (int n = 0; n < g_DetachedListsCount; n++)
+        threads[n].join();
+    for (int n = 0; n < g_DetachedListsCount; n++)
+        ImGui::GetWindowDrawList()->AddDrawList(g_DetachedLists[n]);
+    ImGui::End();
+}
+
+static const FrameScene g_FrameScenes[] =
+{
+    { "demo",               "ShowDemoWindow()",                                         NULL, SceneDemo, NULL, false, 0 },
+    { "text_10k",           "10,000 Text() lines in one window",                        NULL, SceneText10k, NULL, false, 10000 },
+    { "buttons_5k",         "5,000 Button() in one window",                             NULL, SceneButtons5k, NULL, false, 5000 },
+    { "buttons_5k_rounded", "5,000 Button() with FrameRounding = 4 and FrameBorderSize = 1", SceneButtons5kRoundedSetup, SceneButtons5k, NULL, false, 5000 },
+    { "windows_1k",         "1,000 small windows, mouse moving over them",              NULL, SceneWindows1k, NULL, true, 0 },
+    { "tree_100k",          "111,110 open tree nodes (10 per level, 5 levels)",         NULL, SceneTree100k, NULL, false, 111110 },
+    { "inputtext_large",    "Active InputTextMultiline() with 10,000 lines (640 KB)",   SceneInputTextLargeSetup, SceneInputTextLarge, SceneInputTextLargeTeardown, false, 0 },
+    { "custom_draw",        "200 AA polylines of 200 points, 1,000 circles",            NULL, SceneCustomDraw, NULL, false, 0 },
+    { "cjk_text",           "60 lines of CJK text (see --cjk-font)",                    NULL, SceneCjkText, NULL, false, 0 },
+    { "panels_uncached",    "100 static panels",                                        NULL, ScenePanelsUncached, NULL, false, 0 },
+    { "panels_cached",      "100 static panels using SetNextWindowContentHash()",       NULL, ScenePanelsCached, NULL, false, 0 },
+    { "panels_changing_cached", "100 panels changing every frame using SetNextWindowContentHash()", NULL, ScenePanelsChangingCached, NULL, false, 0 },
+    { "detached_drawlists", "4 draw lists filled by worker threads, then AddDrawList()",SceneDetachedDrawListsSetup, SceneDetachedDrawLists, SceneDetachedDrawListsTeardown, false, 0 },
+};
+
+static ImGuiContext* CreateBenchContext(ImFontAtlas* font_atlas)
+{
+    ImGuiContext* ctx = ImGui::CreateContext(font_atlas);
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // Allow large meshes with 16-bit indices
+    return ctx;
+}
+
+static void RunFrame(const FrameScene& scene, int frame)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    if (scene.MoveMouse)
+        io.MousePos = ImVec2((float)((frame * 23) % 1920), (float)((frame * 17) % 1080));
+    else
+        io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+    ImGui::NewFrame();
+    scene.Submit(frame);
+    ImGui::Render();
+}
+
+static BenchResult RunFrameScene(const FrameScene& scene, const BenchSettings& settings)
+{
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+#ifdef IMGUI_ENABLE_PROFILER
+    if (settings.TracePrefix)
+        ImGui::SetProfilerRecordFrames(settings.Frames);
+#endif
+    if (scene.Setup)
+        scene.Setup();
+
+    int frame = 0;
+    for (int n = 0; n < settings.WarmupFrames; n++)
+        RunFrame(scene, frame++);
+
+    double total_ns = 0.0, min_ns = 0.0;
+    const int alloc_count_start = g_AllocCount;
+    const size_t alloc_bytes_start = g_AllocBytes;
+    for (int n = 0; n < settings.Frames; n++)
+    {
+        const double t0 = GetTimeNs();
+        RunFrame(scene, frame++);
+        const double dt = GetTimeNs() - t0;
+        total_ns += dt;
+        min_ns = (n == 0 || dt < min_ns) ? dt : min_ns;
+    }
+    const int frames = settings.Frames > 0 ? settings.Frames : 1;
+
+    BenchResult result;
+    result.Name = scene.Name;
+    result.Add("ns_per_frame", total_ns / frames);
+    result.Add("ns_per_frame_min", min_ns);
+    if (scene.ItemsCount > 0)
+        result.Add("ns_per_item", total_ns / frames / scene.ItemsCount);
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    int cmd_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        cmd_count += draw_data->CmdLists[n]->CmdBuffer.Size;
+    result.Add("vertices", draw_data->TotalVtxCount);
+    result.Add("vtx_bytes", draw_data->TotalVtxCount * (int)sizeof(ImDrawVert));
+    result.Add("indices", draw_data->TotalIdxCount);
+    result.Add("draw_cmds", cmd_count);
+    result.Add("draw_lists", draw_data->CmdListsCount);
+    result.Add("allocs_per_frame", (double)(g_AllocCount - alloc_count_start) / frames);
+    result.Add("alloc_bytes_per_frame", (double)(g_AllocBytes - alloc_bytes_start) / frames);
+
+#ifdef IMGUI_ENABLE_PROFILER
+    if (settings.TracePrefix)
+    {
+        std::string filename = std::string(settings.TracePrefix) + scene.Name + ".json";
+        if (!ImGui::SaveProfilerTraceToDisk(filename.c_str()))
+            fprintf(stderr, "Failed to write '%s'\n", filename.c_str());
+    }
+#endif
+
+    if (scene.Teardown)
+        scene.Teardown();
+    ImGui::DestroyContext(ctx);
+    return result;
+}
+
+// Replay inputs recorded with ImGui::StartInputRecording()/SaveInputRecordingToDisk() over ShowDemoWindow().
+// To reproduce a sequence recorded in your application, copy this loop into a headless harness submitting your own UI.
+static bool RunReplay(BenchResult* result, const BenchSettings& settings)
+{
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+    if (!ImGui::LoadInputRecordingFromDisk(settings.ReplayFilename))
+    {
+        ImGui::DestroyContext(ctx);
+        return false;
+    }
+    double total_ns = 0.0, min_ns = 0.0, max_ns = 0.0;
+    int frames = 0;
+    const int alloc_count_start = g_AllocCount;
+    while (ImGui::IsInputReplaying())
+    {
+        const double t0 = GetTimeNs();
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow();
+        ImGui::Render();
+        const double dt = GetTimeNs() - t0;
+        total_ns += dt;
+        min_ns = (frames == 0 || dt < min_ns) ? dt : min_ns;
+        max_ns = (frames == 0 || dt > max_ns) ? dt : max_ns;
+        frames++;
+    }
+    result->Name = "replay";
+    result->Add("frames", frames);
+    result->Add("ns_per_frame", frames > 0 ? total_ns / frames : 0.0);
+    result->Add("ns_per_frame_min", min_ns);
+    result->Add("ns_per_frame_max", max_ns);
+    result->Add("allocs_per_frame", frames > 0 ? (double)(g_AllocCount - alloc_count_start) / frames : 0.0);
+    ImGui::DestroyContext(ctx);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Micro benchmarks: measure one internal operation, report ns per operation
+//-----------------------------------------------------------------------------
+
+struct MicroBench
+{
+    const char*     Name;
+    const char*     Desc;
+    void            (*Run)(BenchResult* result, const BenchSettings& settings);
+};
+
+static void BenchHashLabel(BenchResult* result, const BenchSettings& settings)
+{
+    IM_UNUSED(settings);
+    static const char* labels[] = { "OK", "Cancel", "Button", "Enable vsync", "##hidden_label", "Save###SaveButton", "Background color", "Node 1234 (depth 3)" };
+    const int count = 4000000;
+    ImU32 seed = 0;
+    size_t total_len = 0;
+    const double t0 = GetTimeNs();
+    for (int n = 0; n < count; n++)
+        seed = ImHashStr(labels[n % IM_ARRAYSIZE(labels)], 0, seed);
+    const double dt = GetTimeNs() - t0;
+    for (int n = 0; n < IM_ARRAYSIZE(labels); n++)
+        total_len += strlen(labels[n]);
+    g_Sink = seed;
+    result->Add("ns_per_label", dt / count);
+    result->Add("avg_label_len", (double)total_len / IM_ARRAYSIZE(labels));
+}
+
+// ImGuiStorage (sorted vector, binary search) vs ImGuiHashStorage (open addressing)
+static void BenchStorage(BenchResult* result, int key_count)
+{
+    std::vector<ImGuiID> keys(key_count);
+    for (int n = 0; n < key_count; n++)
+        keys[n] = Random() | 1;
+    std::vector<ImGuiID> lookup_keys(keys);
+    for (int n = key_count - 1; n > 0; n--)
+        std::swap(lookup_keys[n], lookup_keys[Random() % (n + 1)]);
+    ImU32 sum = 0;
+
+    // ImGuiStorage: inserting in random order moves half the vector on average, only measure it on small sets.
+    // Larger sets are built in bulk, the fastest way to fill one.
+    if (key_count <= 10000)
+    {
+        ImGuiStorage storage;
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < key_count; n++)
+            storage.SetInt(keys[n], n);
+        result->Add("storage_insert_ns", (GetTimeNs() - t0) / key_count);
+    }
+    ImGuiStorage storage;
+    {
+        const double t0 = GetTimeNs();
+        storage.Data.reserve(key_count);
+        for (int n = 0; n < key_count; n++)
+            storage.Data.push_back(ImGuiStorage::ImGuiStoragePair(keys[n], n));
+        storage.BuildSortByKey();
+        result->Add("storage_bulk_build_ns", (GetTimeNs() - t0) / key_count);
+    }
+    {
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < key_count; n++)
+            sum += (ImU32)storage.GetInt(lookup_keys[n]);
+        result->Add("storage_lookup_ns", (GetTimeNs() - t0) / key_count);
+    }
+
+    ImGuiHashStorage hash_storage;
+    {
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < key_count; n++)
+            hash_storage.SetInt(keys[n], n);
+        result->Add("hash_storage_insert_ns", (GetTimeNs() - t0) / key_count);
+    }
+    {
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < key_count; n++)
+            sum += (ImU32)hash_storage.GetInt(lookup_keys[n]);
+        result->Add("hash_storage_lookup_ns", (GetTimeNs() - t0) / key_count);
+    }
+    g_Sink = sum;
+}
+static void BenchStorage1k(BenchResult* result, const BenchSettings& settings)   { IM_UNUSED(settings); BenchStorage(result, 1000); }
+static void BenchStorage100k(BenchResult* result, const BenchSettings& settings) { IM_UNUSED(settings); BenchStorage(result, 100000); }
+static void BenchStorage1M(BenchResult* result, const BenchSettings& settings)   { IM_UNUSED(settings); BenchStorage(result, 1000000); }
+
+static void BenchIniLoad50k(BenchResult* result, const BenchSettings& settings)
+{
+    const int window_count = 50000;
+    ImGuiTextBuffer ini;
+    for (int n = 0; n < window_count; n++)
+        ini.appendf("[Window][Window %d]\nPos=%d,%d\nSize=%d,%d\nCollapsed=%d\n\n", n, n % 1800, n % 1000, 100 + n % 200, 100 + n % 150, n & 1);
+
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+    double t0 = GetTimeNs();
+    ImGui::LoadIniSettingsFromMemory(ini.c_str(), (size_t)ini.size());
+    result->Add("load_ms", (GetTimeNs() - t0) / 1000000.0);
+
+    ImU32 found = 0;
+    char name[32];
+    t0 = GetTimeNs();
+    for (int n = 0; n < window_count; n++)
+    {
+        sprintf(name, "Window %d", (n * 7919) % window_count);
+        found += ImGui::FindWindowSettings(ImHashStr(name)) ? 1 : 0;
+    }
+    result->Add("find_settings_ns", (GetTimeNs() - t0) / window_count);
+    result->Check(found == window_count, "FindWindowSettings() didn't find every loaded window");
+    g_Sink = found;
+
+    size_t out_size = 0;
+    t0 = GetTimeNs();
+    ImGui::SaveIniSettingsToMemory(&out_size);
+    result->Add("save_ms", (GetTimeNs() - t0) / 1000000.0);
+    result->Add("ini_bytes", (double)out_size);
+    ImGui::DestroyContext(ctx);
+}
+
+// Per-item cost of the layout/clipping functions called by every widget, on a 10,000 items window
+static void BenchItems10k(BenchResult* result, const BenchSettings& settings)
+{
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+    const int items_count = 10000;
+    const int frames = 100;
+    double total_ns = 0.0, min_ns = 0.0;
+    int visible_count = 0;
+    for (int frame = 0; frame < frames + 3; frame++)
+    {
+        ImGui::NewFrame();
+        BeginFullscreenWindow("Items");
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        const ImVec2 item_size(200.0f, ImGui::GetTextLineHeight());
+        visible_count = 0;
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < items_count; n++)
+        {
+            const ImGuiID id = window->GetID(n);
+            const ImRect bb(window->DC.CursorPos.x, window->DC.CursorPos.y, window->DC.CursorPos.x + item_size.x, window->DC.CursorPos.y + item_size.y);
+            ImGui::ItemSize(bb);
+            if (ImGui::ItemAdd(bb, id))
+                visible_count++;
+        }
+        const double dt = GetTimeNs() - t0;
+        if (frame >= 3)
+        {
+            total_ns += dt;
+            min_ns = (frame == 3 || dt < min_ns) ? dt : min_ns;
+        }
+        ImGui::End();
+        ImGui::Render();
+    }
+    result->Add("ns_per_item", total_ns / frames / items_count);
+    result->Add("ns_per_item_min", min_ns / items_count);
+    result->Add("visible_items", visible_count);
+    ImGui::DestroyContext(ctx);
+}
+
+// Tree nodes with io.ConfigWindowsStorageGcFrames: per frame cost with the state storage compacted every frame, and with the timer disabled
+// Button() with typical labels, hashed at runtime or precomputed at compile-time with IM_LABEL_LITERAL()
+static void SubmitLabelButtons(int count, bool literal)
+{
+    for (int n = 0; n < count; n++)
+    {
+        ImGui::PushID(n);
+        if (n % 4 != 0)
+            ImGui::SameLine();
+        switch (n % 4)
+        {
+        case 0: ImGui::Button(literal ? IM_LABEL_LITERAL("Apply changes") : "Apply changes"); break;
+        case 1: ImGui::Button(literal ? IM_LABEL_LITERAL("Enable vsync") : "Enable vsync"); break;
+        case 2: ImGui::Button(literal ? IM_LABEL_LITERAL("Background color") : "Background color"); break;
+        case 3: ImGui::Button(literal ? IM_LABEL_LITERAL("Save###SaveButton") : "Save###SaveButton"); break;
+        }
+        ImGui::PopID();
+    }
+}
+
+static void BenchLabelLiterals(BenchResult* result, const BenchSettings& settings)
+{
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+    const int items_count = 10000;
+    const int frames = 50;
+    double min_ns[2] = { 0.0, 0.0 };
+    for (int frame = 0; frame < frames + 3; frame++)
+        for (int literal = 0; literal < 2; literal++)
+        {
+            ImGui::NewFrame();
+            BeginFullscreenWindow("Buttons");
+            const double t0 = GetTimeNs();
+            SubmitLabelButtons(items_count, literal != 0);
+            const double dt = GetTimeNs() - t0;
+            if (frame >= 3)
+                min_ns[literal] = (frame == 3 || dt < min_ns[literal]) ? dt : min_ns[literal];
+            ImGui::End();
+            ImGui::Render();
+        }
+    result->Add("ns_per_item_min", min_ns[0] / items_count);
+    result->Add("literal_ns_per_item_min", min_ns[1] / items_count);
+    ImGui::DestroyContext(ctx);
+}
+
+static void BenchStorageGc(BenchResult* result, const BenchSettings& settings, float compact_timer)
+{
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigWindowsStorageGcFrames = 60;
+    io.ConfigWindowsMemoryCompactTimer = compact_timer;
+    const int nodes_count = 10000;
+    const int frames = 100;
+    double total_ns = 0.0, min_ns = 0.0;
+    ImGuiWindow* window = NULL;
+    for (int frame = 0; frame < frames + 3; frame++)
+    {
+        const double t0 = GetTimeNs();
+        ImGui::NewFrame();
+        BeginFullscreenWindow("Tree");
+        window = ImGui::GetCurrentWindow();
+        for (int n = 0; n < nodes_count; n++)
+        {
+            ImGui::SetNextItemOpen((n & 1) != 0, ImGuiCond_Once);
+            if (ImGui::TreeNode((void*)(intptr_t)n, "Node %d", n))
+                ImGui::TreePop();
+        }
+        ImGui::End();
+        ImGui::Render();
+        const double dt = GetTimeNs() - t0;
+        if (frame >= 3)
+        {
+            total_ns += dt;
+            min_ns = (frame == 3 || dt < min_ns) ? dt : min_ns;
+        }
+    }
+    result->Check(compact_timer >= 0.0f || window->StateStorageGcTime == 0.0f, "state storage compacted while io.ConfigWindowsMemoryCompactTimer < 0");
+    result->Add("ns_per_frame", total_ns / frames);
+    result->Add("ns_per_frame_min", min_ns);
+    result->Add("storage_entries", window->StateStorage.Data.Size);
+    result->Add("storage_gc_ran", window->StateStorageGcTime > 0.0f ? 1 : 0);
+    ImGui::DestroyContext(ctx);
+}
+static void BenchStorageGcEveryFrame(BenchResult* result, const BenchSettings& settings)  { BenchStorageGc(result, settings, 0.0f); }
+static void BenchStorageGcDisabled(BenchResult* result, const BenchSettings& settings)    { BenchStorageGc(result, settings, -1.0f); }
+
+// ImDrawList::AddPolyline(), 10 lines of 5,000 points (an oscilloscope-like view with 50,000 points)
+static void BenchPolyline(BenchResult* result, const BenchSettings& settings, bool closed, float thickness, ImDrawListFlags flags)
+{
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+    ImGui::NewFrame();      // Setup draw list shared data (white pixel, baked lines) from the font atlas
+    ImGui::EndFrame();
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    const int lines_count = 10;
+    const int points_per_line = 5000;
+    ImVector<ImVec2> points;
+    points.resize(lines_count * points_per_line);
+    for (int n = 0; n < points.Size; n++)
+        points[n] = ImVec2((n % points_per_line) * (1900.0f / points_per_line), 50.0f + (n / points_per_line) * 100.0f + ImSin(n * 0.05f) * 40.0f + (Random() % 1000) * 0.01f);
+
+    const int iterations = 50;
+    double total_ns = 0.0, min_ns = 0.0;
+    for (int iter = 0; iter < iterations; iter++)
+    {
+        draw_list.Clear();
+        draw_list.Flags = flags | ImDrawListFlags_AllowVtxOffset;    // Clear() resets flags to the shared data defaults
+        draw_list.PushClipRectFullScreen();
+        draw_list.PushTextureID(NULL);
+        const double t0 = GetTimeNs();
+        for (int line_n = 0; line_n < lines_count; line_n++)
+            draw_list.AddPolyline(&points[line_n * points_per_line], points_per_line, IM_COL32(255, 255, 0, 255), closed, thickness);
+        const double dt = GetTimeNs() - t0;
+        total_ns += dt;
+        min_ns = (iter == 0 || dt < min_ns) ? dt : min_ns;
+    }
+    result->Add("ns_per_point", total_ns / iterations / points.Size);
+    result->Add("ns_per_point_min", min_ns / points.Size);
+    result->Add("vertices", draw_list.VtxBuffer.Size);
+    result->Add("indices", draw_list.IdxBuffer.Size);
+    g_Sink = (ImU32)draw_list.VtxBuffer.Size;
+    ImGui::DestroyContext(ctx);
+}
+
+static void BenchPolylineThinOpen(BenchResult* result, const BenchSettings& settings)    { BenchPolyline(result, settings, false, 1.0f, ImDrawListFlags_AntiAliasedLines); }
+static void BenchPolylineThinClosed(BenchResult* result, const BenchSettings& settings)  { BenchPolyline(result, settings, true, 1.0f, ImDrawListFlags_AntiAliasedLines); }
+static void BenchPolylineThickOpen(BenchResult* result, const BenchSettings& settings)   { BenchPolyline(result, settings, false, 3.0f, ImDrawListFlags_AntiAliasedLines); }
+static void BenchPolylineThickClosed(BenchResult* result, const BenchSettings& settings) { BenchPolyline(result, settings, true, 3.0f, ImDrawListFlags_AntiAliasedLines); }
+static void BenchPolylineTexThin(BenchResult* result, const BenchSettings& settings)     { BenchPolyline(result, settings, false, 1.0f, ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex); }
+static void BenchPolylineTexThick(BenchResult* result, const BenchSettings& settings)    { BenchPolyline(result, settings, false, 3.0f, ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex); }
+static void BenchPolylineNoAA(BenchResult* result, const BenchSettings& settings)        { BenchPolyline(result, settings, false, 2.0f, ImDrawListFlags_None); }
+static void BenchPolylineNoAAShared(BenchResult* result, const BenchSettings& settings)  { BenchPolyline(result, settings, false, 2.0f, ImDrawListFlags_SharedEdgeLines); }
+
+// ImDrawList::AddRectFilled()/AddRect() with rounding 4 and AddCircleFilled() with radius 5, 10,000 of each
+static void BenchRoundCorners(BenchResult* result, const BenchSettings& settings, ImDrawListFlags flags)
+{
+    ImGuiContext* ctx = CreateBenchContext(settings.FontAtlas);
+    ImGui::NewFrame();      // Setup draw list shared data (white pixel, baked round corners) from the font atlas
+    ImGui::EndFrame();
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    const int shapes_count = 10000;
+
+    const int iterations = 50;
+    double total_ns = 0.0, min_ns = 0.0;
+    for (int iter = 0; iter < iterations; iter++)
+    {
+        draw_list.Clear();
+        draw_list.Flags = flags | ImDrawListFlags_AllowVtxOffset;    // Clear() resets flags to the shared data defaults
+        draw_list.PushClipRectFullScreen();
+        draw_list.PushTextureID(NULL);
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < shapes_count; n++)
+        {
+            const ImVec2 p((float)((n * 37) % 1800), (float)((n * 53) % 1000));
+            draw_list.AddRectFilled(p, ImVec2(p.x + 80.0f, p.y + 20.0f), IM_COL32(40, 80, 160, 255), 4.0f);
+            draw_list.AddRect(p, ImVec2(p.x + 80.0f, p.y + 20.0f), IM_COL32(255, 255, 255, 255), 4.0f);
+            draw_list.AddCircleFilled(ImVec2(p.x + 100.0f, p.y + 10.0f), 5.0f, IM_COL32(255, 255, 0, 255));
+        }
+        const double dt = GetTimeNs() - t0;
+        total_ns += dt;
+        min_ns = (iter == 0 || dt < min_ns) ? dt : min_ns;
+    }
+    result->Add("ns_per_shape", total_ns / iterations / (shapes_count * 3));
+    result->Add("ns_per_shape_min", min_ns / (shapes_count * 3));
+    result->Add("vertices", draw_list.VtxBuffer.Size);
+    result->Add("indices", draw_list.IdxBuffer.Size);
+    g_Sink = (ImU32)draw_list.VtxBuffer.Size;
+    ImGui::DestroyContext(ctx);
+}
+
+static void BenchRoundCornersGeometry(BenchResult* result, const BenchSettings& settings) { BenchRoundCorners(result, settings, ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill); }
+static void BenchRoundCornersTex(BenchResult* result, const BenchSettings& settings)      { BenchRoundCorners(result, settings, ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_RoundCornersUseTex); }
+
+static const MicroBench g_MicroBenches[] =
+{
+    { "hash_label",         "ImHashStr() on typical widget labels",                     BenchHashLabel },
+    { "storage_1k",         "ImGuiStorage vs ImGuiHashStorage, 1,000 keys",             BenchStorage1k },
+    { "storage_100k",       "ImGuiStorage vs ImGuiHashStorage, 100,000 keys",           BenchStorage100k },
+    { "storage_1m",         "ImGuiStorage vs ImGuiHashStorage, 1,000,000 keys",         BenchStorage1M },
+    { "ini_load_50k",       "Load/query/save .ini data for 50,000 windows",             BenchIniLoad50k },
+    { "items_10k",          "GetID() + ItemSize() + ItemAdd() on 10,000 items",         BenchItems10k },
+    { "label_literals_10k", "10,000 Button(), labels hashed at runtime vs IM_LABEL_LITERAL()", BenchLabelLiterals },
+    { "storage_gc_10k",     "10,000 tree nodes, storage GC every frame",                BenchStorageGcEveryFrame },
+    { "storage_gc_10k_off", "Same, with io.ConfigWindowsMemoryCompactTimer = -1",       BenchStorageGcDisabled },
+    { "polyline_thin_open",     "AA AddPolyline(), 50,000 points, thickness 1, open",   BenchPolylineThinOpen },
+    { "polyline_thin_closed",   "AA AddPolyline(), 50,000 points, thickness 1, closed", BenchPolylineThinClosed },
+    { "polyline_thick_open",    "AA AddPolyline(), 50,000 points, thickness 3, open",   BenchPolylineThickOpen },
+    { "polyline_thick_closed",  "AA AddPolyline(), 50,000 points, thickness 3, closed", BenchPolylineThickClosed },
+    { "polyline_tex_thin",      "AA AddPolyline() using baked lines, thickness 1",      BenchPolylineTexThin },
+    { "polyline_tex_thick",     "AA AddPolyline() using baked lines, thickness 3",      BenchPolylineTexThick },
+    { "polyline_noaa",          "Non-AA AddPolyline(), 50,000 points, thickness 2",     BenchPolylineNoAA },
+    { "polyline_noaa_shared",   "Same, with ImDrawListFlags_SharedEdgeLines",           BenchPolylineNoAAShared },
+    { "round_corners",          "AA rounded AddRectFilled()/AddRect(), AddCircleFilled(), 10,000 each", BenchRoundCornersGeometry },
+    { "round_corners_tex",      "Same, using baked round corners",                      BenchRoundCornersTex },
+};
+
+//-----------------------------------------------------------------------------
+// Output
+//-----------------------------------------------------------------------------
+
+static void PrintResult(const BenchResult& result)
+{
+    printf("%-20s", result.Name.c_str());
+    for (size_t n = 0; n < result.Values.size(); n++)
+        printf(" %s=%.6g", result.Values[n].first.c_str(), result.Values[n].second);
+    printf("\n");
+    fflush(stdout);
+}
+
+static bool WriteJson(const char* filename, const BenchSettings& settings, const std::vector<BenchResult>& results)
+{
+    FILE* f = fopen(filename, "wt");
+    if (!f)
+        return false;
+    fprintf(f, "{\n  \"imgui_version\": \"%s\",\n  \"frames\": %d,\n  \"warmup_frames\": %d,\n", IMGUI_VERSION, settings.Frames, settings.WarmupFrames);
+    fprintf(f, "  \"sizeof_imdrawidx\": %d,\n  \"sizeof_imdrawvert\": %d,\n", (int)sizeof(ImDrawIdx), (int)sizeof(ImDrawVert));
+#ifdef NDEBUG
+    fprintf(f, "  \"asserts\": false,\n");
+#else
+    fprintf(f, "  \"asserts\": true,\n");
+#endif
+    fprintf(f, "  \"results\": [\n");
+    for (size_t result_n = 0; result_n < results.size(); result_n++)
+    {
+        const BenchResult& result = results[result_n];
+        fprintf(f, "    { \"name\": \"%s\"", result.Name.c_str());
+        for (size_t n = 0; n < result.Values.size(); n++)
+            fprintf(f, ", \"%s\": %.6g", result.Values[n].first.c_str(), result.Values[n].second);
+        fprintf(f, " }%s\n", (result_n + 1 < results.size()) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+static bool MatchFilter(const char* name, const char* filter)
+{
+    return filter == NULL || strstr(name, filter) != NULL;
+}
+
+int main(int argc, char** argv)
+{
+    BenchSettings settings;
+    for (int n = 1; n < argc; n++)
+    {
+        const char* arg = argv[n];
+        const char* value = (n + 1 < argc) ? argv[n + 1] : NULL;
+        if (strcmp(arg, "--list") == 0)                     { settings.ListOnly = true; continue; }
+        if (value == NULL)                                  { fprintf(stderr, "Missing value for '%s'\n", arg); return 1; }
+        if (strcmp(arg, "--frames") == 0)                   settings.Frames = atoi(value);
+        else if (strcmp(arg, "--warmup") == 0)              settings.WarmupFrames = atoi(value);
+        else if (strcmp(arg, "--scene") == 0)               settings.Filter = value;
+        else if (strcmp(arg, "--json") == 0)                settings.JsonFilename = value;
+        else if (strcmp(arg, "--cjk-font") == 0)            settings.CjkFontFilename = value;
+        else if (strcmp(arg, "--trace") == 0)               settings.TracePrefix = value;
+        else if (strcmp(arg, "--replay") == 0)              settings.ReplayFilename = value;
+        else                                                { fprintf(stderr, "Unknown argument '%s'\n", arg); return 1; }
+        n++;
+    }
+
+    if (settings.ListOnly)
+    {
+        for (int n = 0; n < IM_ARRAYSIZE(g_FrameScenes); n++)
+            printf("%-20s %s\n", g_FrameScenes[n].Name, g_FrameScenes[n].Desc);
+        for (int n = 0; n < IM_ARRAYSIZE(g_MicroBenches); n++)
+            printf("%-20s %s\n", g_MicroBenches[n].Name, g_MicroBenches[n].Desc);
+        return 0;
+    }
+#ifndef IMGUI_ENABLE_PROFILER
+    if (settings.TracePrefix)
+        fprintf(stderr, "Ignoring --trace: imgui was compiled without IMGUI_ENABLE_PROFILER\n");
+#endif
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(CountingAlloc, CountingFree);
+
+    // All contexts share the same font atlas, built once
+    ImFontAtlas font_atlas;
+    font_atlas.AddFontDefault();
+    if (settings.CjkFontFilename)
+    {
+        ImFontConfig config;
+        config.MergeMode = true;
+        if (!font_atlas.AddFontFromFileTTF(settings.CjkFontFilename, 13.0f, &config, font_atlas.GetGlyphRangesChineseSimplifiedCommon()))
+            fprintf(stderr, "Failed to load '%s'\n", settings.CjkFontFilename);
+    }
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    font_atlas.GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    settings.FontAtlas = &font_atlas;
+
+    printf("DearImGui %s, %d frames (+%d warmup)\n", IMGUI_VERSION, settings.Frames, settings.WarmupFrames);
+    std::vector<BenchResult> results;
+    if (settings.ReplayFilename)
+    {
+        BenchResult result;
+        if (!RunReplay(&result, settings))
+        {
+            fprintf(stderr, "Failed to load input recording '%s'\n", settings.ReplayFilename);
+            return 1;
+        }
+        results.push_back(result);
+        PrintResult(results.back());
+    }
+    const bool run_scenes = (settings.ReplayFilename == NULL || settings.Filter != NULL);   // When replaying, only run other scenes if explicitly requested
+    for (int n = 0; n < IM_ARRAYSIZE(g_FrameScenes); n++)
+        if (run_scenes && MatchFilter(g_FrameScenes[n].Name, settings.Filter))
+        {
+            results.push_back(RunFrameScene(g_FrameScenes[n], settings));
+            PrintResult(results.back());
+        }
+    for (int n = 0; n < IM_ARRAYSIZE(g_MicroBenches); n++)
+        if (run_scenes && MatchFilter(g_MicroBenches[n].Name, settings.Filter))
+        {
+            BenchResult result;
+            result.Name = g_MicroBenches[n].Name;
+            g_MicroBenches[n].Run(&result, settings);
+            results.push_back(result);
+            PrintResult(results.back());
+        }
+
+    if (settings.JsonFilename && !WriteJson(settings.JsonFilename, settings, results))
+    {
+        fprintf(stderr, "Failed to write '%s'\n", settings.JsonFilename);
+        return 1;
+    }
+    for (size_t n = 0; n < results.size(); n++)
+        if (results[n].Failed)
+            return 1;
+    return 0;
+}
@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Debug
+cl /nologo /Zi /MD /EHsc /I ..\.. /D IMGUI_USE_THREAD_LOCAL_CONTEXT %* main.cpp ..\..\imgui.cpp ..\..\imgui_draw.cpp ..\..\imgui_widgets.cpp /FeDebug/example_null_threads.exe /FoDebug/ /link gdi32.lib shell32.lib
@@ -0,0 +1,172 @@
+// dear imgui: null/dummy example application, multi-threaded
+// (compile and link imgui with IMGUI_USE_THREAD_LOCAL_CONTEXT, run N independent contexts on N threads, headless with NO GRAPHICS OUTPUT)
+// This is used to stress test running contexts in parallel and measure how throughput scales with the number of threads.
+// Usage: example_null_threads [max_threads] [frames_per_thread] [shared_font_atlas=1]
+#include "imgui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#ifndef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#error "This example requires IMGUI_USE_THREAD_LOCAL_CONTEXT (see Makefile)"
+#endif
+
+// Per-thread allocator, to verify that each context allocates with the functions of the thread which created it
+struct ThreadAllocator
+{
+    int     ActiveAllocations;
+    int     TotalAllocations;
+    ThreadAllocator() { ActiveAllocations = TotalAllocations = 0; }
+};
+static void* ThreadAllocatorAlloc(size_t size, void* user_data) { ThreadAllocator* a = (ThreadAllocator*)user_data; a->ActiveAllocations++; a->TotalAllocations++; return malloc(size); }
+static void  ThreadAllocatorFree(void* ptr, void* user_data)    { ThreadAllocator* a = (ThreadAllocator*)user_data; if (ptr) a->ActiveAllocations--; free(ptr); }
+
+struct ThreadResult
+{
+    ImU64   LastDrawDataHash;
+    int     LastVtxCount;
+    int     MetricsActiveAllocations;
+    int     AllocatorActiveAllocationsAfterDestroy;
+    int     AllocatorTotalAllocations;
+};
+
+// A scene touching most of the common widgets. Note that ShowDemoWindow() can't be used as it stores its state in static variables.
+static void SubmitScene(int frame, float* values, bool* checks)
+{
+    for (int window_n = 0; window_n < 8; window_n++)
+    {
+        ImGui::SetNextWindowPos(ImVec2((float)(window_n % 4) * 300.0f, (float)(window_n / 4) * 400.0f), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(280.0f, 380.0f), ImGuiCond_Once);
+        char title[32];
+        sprintf(title, "Window %d", window_n);
+        ImGui::Begin(title);
+        ImGui::Text("Frame %d, window %d", frame, window_n);
+        ImGui::SliderFloat("Value", &values[window_n], 0.0f, 1.0f);
+        ImGui::Checkbox("Check", &checks[window_n]);
+        if (ImGui::Button("Button"))
+            checks[window_n] = !checks[window_n];
+        if (ImGui::TreeNode("Items"))
+        {
+            for (int item_n = 0; item_n < 16; item_n++)
+                ImGui::BulletText("Item %d: %.3f", item_n, values[window_n] * item_n);
+            ImGui::TreePop();
+        }
+        float plot[32];
+        for (int n = 0; n < IM_ARRAYSIZE(plot); n++)
+            plot[n] = (float)((n * 7 + frame + window_n) % 13);
+        ImGui::PlotLines("Plot", plot, IM_ARRAYSIZE(plot), 0, NULL, 0.0f, 12.0f, ImVec2(0.0f, 40.0f));
+        ImGui::Columns(3, "columns");
+        for (int cell_n = 0; cell_n < 12; cell_n++)
+        {
+            ImGui::Text("Cell %d", cell_n);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::End();
+    }
+}
+
+static void RunContext(int frames, ImFontAtlas* shared_font_atlas, ThreadResult* result)
+{
+    ThreadAllocator allocator;
+    ImGui::SetAllocatorFunctions(ThreadAllocatorAlloc, ThreadAllocatorFree, &allocator);
+
+    ImGuiContext* ctx = ImGui::CreateContext(shared_font_atlas);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.ConfigDrawDataHash = true;
+
+    // Build atlas (unless using the shared one, which is already built)
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    if (shared_font_atlas == NULL)
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    float values[8] = {};
+    bool checks[8] = {};
+    for (int frame = 0; frame < frames; frame++)
+    {
+        // Move the mouse around in a deterministic way so that every thread produces the same output
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.MousePos = ImVec2((float)((frame * 37) % 1200), (float)((frame * 53) % 800));
+        io.MouseDown[0] = (frame % 10) < 3;
+        ImGui::NewFrame();
+        SubmitScene(frame, values, checks);
+        ImGui::Render();
+    }
+
+    result->LastDrawDataHash = ImGui::GetDrawData()->ContentHash;
+    result->LastVtxCount = ImGui::GetDrawData()->TotalVtxCount;
+    result->MetricsActiveAllocations = io.MetricsActiveAllocations;
+    ImGui::DestroyContext(ctx);
+    result->AllocatorActiveAllocationsAfterDestroy = allocator.ActiveAllocations;
+    result->AllocatorTotalAllocations = allocator.TotalAllocations;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int max_threads = (argc > 1) ? atoi(argv[1]) : (int)std::thread::hardware_concurrency();
+    int frames = (argc > 2) ? atoi(argv[2]) : 500;
+    bool use_shared_font_atlas = (argc > 3) ? (atoi(argv[3]) != 0) : true;
+    if (max_threads < 1)
+        max_threads = 1;
+
+    // A single read-only atlas can be used by all contexts, instead of each context building its own copy
+    ImFontAtlas* shared_font_atlas = NULL;
+    if (use_shared_font_atlas)
+    {
+        shared_font_atlas = new ImFontAtlas();
+        shared_font_atlas->LockForSharing();
+    }
+
+    // Reference run, on its own thread as RunContext() installs an allocator only valid during the call
+    ThreadResult reference;
+    std::thread(RunContext, frames, shared_font_atlas, &reference).join();
+    IM_ASSERT(ImGui::GetCurrentContext() == NULL);
+
+    printf("%d frames per thread, up to %d threads, %s font atlas\n", frames, max_threads, use_shared_font_atlas ? "shared" : "per-context");
+    printf("threads     time(ms)   frames/s   speedup   efficiency\n");
+    std::vector<int> threads_counts;
+    for (int threads_count = 1; threads_count < max_threads; threads_count *= 2)
+        threads_counts.push_back(threads_count);
+    threads_counts.push_back(max_threads);
+
+    double single_thread_time = 0.0;
+    bool ok = true;
+    for (int threads_count : threads_counts)
+    {
+        std::vector<ThreadResult> results(threads_count);
+        std::vector<std::thread> threads;
+        std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        for (int thread_n = 0; thread_n < threads_count; thread_n++)
+            threads.push_back(std::thread(RunContext, frames, shared_font_atlas, &results[thread_n]));
+        for (std::thread& thread : threads)
+            thread.join();
+        double time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+        if (threads_count == 1)
+            single_thread_time = time;
+
+        // Every context ran the same scene and must have produced the same output, and released all its memory with its own allocator
+        for (int thread_n = 0; thread_n < threads_count; thread_n++)
+        {
+            const ThreadResult& r = results[thread_n];
+            if (r.LastDrawDataHash != reference.LastDrawDataHash || r.LastVtxCount != reference.LastVtxCount || r.AllocatorActiveAllocationsAfterDestroy != 0 || r.AllocatorTotalAllocations == 0)
+            {
+                printf("Thread %d/%d: mismatch! (vtx %d vs %d, %d allocations not freed)\n", thread_n, threads_count, r.LastVtxCount, reference.LastVtxCount, r.AllocatorActiveAllocationsAfterDestroy);
+                ok = false;
+            }
+        }
+
+        double speedup = single_thread_time * threads_count / time;
+        printf("%7d   %10.1f %10.0f %9.2fx %11.0f%%\n", threads_count, time * 1000.0, frames * threads_count / time, speedup, speedup * 100.0 / threads_count);
+    }
+
+    printf("%s (%d active allocations per context)\n", ok ? "OK" : "FAILED", reference.MetricsActiveAllocations);
+    delete shared_font_atlas;
+    return ok ? 0 : 1;
+}
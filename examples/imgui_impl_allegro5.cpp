@@ -35,6 +35,9 @@
 #include <cstring>      // memcpy
 #include "imgui.h"
 #include "imgui_impl_allegro5.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by this back-end."
+#endif
 
 // Allegro
 #include <allegro5/allegro.h>
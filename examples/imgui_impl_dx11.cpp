@@ -27,6 +27,9 @@
 
 #include "imgui.h"
 #include "imgui_impl_dx11.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by this back-end."
+#endif
 
 // DirectX
 #include <stdio.h>
@@ -24,6 +24,9 @@
 
 #include "imgui.h"
 #include "imgui_impl_dx9.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by this back-end."
+#endif
 
 // DirectX
 #include <d3d9.h>
@@ -21,6 +21,9 @@
 
 #include "imgui.h"
 #include "imgui_impl_marmalade.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by this back-end."
+#endif
 
 #include <s3eClipboard.h>
 #include <s3ePointer.h>
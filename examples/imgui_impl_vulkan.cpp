@@ -22,6 +22,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2020-04-10: Vulkan: Added support for the compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT).
 //  2019-08-01: Vulkan: Added support for specifying multisample count. Set ImGui_ImplVulkan_InitInfo::MSAASamples to one of the VkSampleCountFlagBits values to use, default is non-multisampled as before.
 //  2019-05-29: Vulkan: Added support for large mesh (64K+ vertices), enable ImGuiBackendFlags_RendererHasVtxOffset flag.
 //  2019-04-30: Vulkan: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
@@ -302,6 +303,11 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkCommandBu
         float translate[2];
         translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
         translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Positions are fixed point integers read as VK_FORMAT_R16G16_SNORM (divided by 32767), fold their scale into the projection
+        scale[0] *= 32767.0f / IM_DRAWVERT_POS_SCALE;
+        scale[1] *= 32767.0f / IM_DRAWVERT_POS_SCALE;
+#endif
         vkCmdPushConstants(command_buffer, g_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
         vkCmdPushConstants(command_buffer, g_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
     }
@@ -686,11 +692,19 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
     VkVertexInputAttributeDescription attribute_desc[3] = {};
     attribute_desc[0].location = 0;
     attribute_desc[0].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[0].format = VK_FORMAT_R16G16_SNORM;     // R16G16_SSCALED would be more natural but isn't guaranteed to be supported for vertex buffers
+#else
     attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[0].offset = IM_OFFSETOF(ImDrawVert, pos);
     attribute_desc[1].location = 1;
     attribute_desc[1].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[1].format = VK_FORMAT_R16G16_UNORM;
+#else
     attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[1].offset = IM_OFFSETOF(ImDrawVert, uv);
     attribute_desc[2].location = 2;
     attribute_desc[2].binding = binding_desc[0].binding;
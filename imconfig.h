@@ -41,6 +41,7 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
+//#define IMGUI_DISABLE_SIMD                                // Don't use SSE2/NEON code paths (e.g. in ImDrawList::AddPolyline()), use the scalar code which produces the same output (see AddPolyline() about FMA contraction).
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -51,6 +52,25 @@
 //---- Use 32-bit for ImWchar (default is 16-bit) to support full unicode code points.
 //#define IMGUI_USE_WCHAR32
 
+//---- Use CRC32C instead of CRC32 for ImHashStr()/ImHashData(), which are used to compute all IDs.
+// When compiling for SSE4.2 (e.g. -msse4.2) or ARMv8 with the CRC extension (e.g. -march=armv8-a+crc), this uses hardware instructions and is much faster.
+// Otherwise a table-based fallback produces the same values. Note that IDs will differ from the ones computed without this option.
+//#define IMGUI_USE_CRC32C_HASH
+
+//---- Store the current context pointer in thread local storage, so that independent contexts can be used from different threads in parallel.
+// Each thread uses its own allocator functions (see SetAllocatorFunctions()), which contexts capture on creation. Requires C++11 or a compiler supporting __thread/__declspec(thread).
+// Not compatible with building Dear ImGui as a DLL with MSVC. ShowDemoWindow(), ShowMetricsWindow() and some glyph ranges helpers use static data and are not thread-safe.
+//#define IMGUI_USE_THREAD_LOCAL_CONTEXT
+
+//---- Enable the frame-phase profiler hooks (see ImGui::SetProfilerCallbacks(), ImGui::SetProfilerRecordFrames(), ImGui::SaveProfilerTraceToDisk()).
+// When not defined the hooks compile to nothing and those functions do nothing.
+//#define IMGUI_ENABLE_PROFILER
+
+//---- Track memory allocations per subsystem (see ImGui::GetMemAllocStats() and Metrics>Memory).
+// Each allocation made by MemAlloc() is prefixed with a 16 bytes header. Memory given to Dear ImGui with ownership (e.g. font data passed to
+// AddFontFromMemoryTTF()) must then be allocated with IM_ALLOC(), and memory returned with ownership (e.g. ImFileLoadToMemory()) must be freed with IM_FREE().
+//#define IMGUI_ENABLE_ALLOC_TRACKING
+
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of imgui cpp files.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
@@ -80,6 +100,18 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert (default is 20 bytes): positions stored as 16-bit signed fixed point with
+// IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS fractional bits (default 2: 1/4 pixel precision, range -8192..+8191.75),
+// UVs stored as 16-bit unsigned normalized (clamped to 0..1). Reduces vertex upload bandwidth by 40%.
+// Positions outside of the range are clamped on each axis separately: axis aligned shapes are only cropped, but slanted
+// lines/triangles crossing the limit get bent (e.g. a long line to a far away point ends at a wrong angle). This only
+// matters for geometry extending more than ~8K pixels away from the origin (e.g. large canvases, zoomed node editors).
+// Clamped positions are counted in the Metrics window, put a breakpoint in ImGui::DebugNotifyDrawVertSaturated() to find them.
+// Your renderer back-end will need to support it (imgui_impl_opengl3.cpp and imgui_impl_vulkan.cpp do, other back-ends fail with an #error).
+// Incompatible with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS 2
+
 //---- Override ImDrawCallback signature (will need to modify renderer back-ends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
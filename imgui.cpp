@@ -56,10 +56,14 @@ CODE
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
+// [SECTION] MISC HELPERS/UTILITIES (Atomics)
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
+// [SECTION] ImGuiHashStorage
+// [SECTION] ImLinearArena
+// [SECTION] ImSlabAllocator
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
 // [SECTION] ImGuiListClipper
@@ -75,6 +79,8 @@ CODE
 // [SECTION] DRAG AND DROP
 // [SECTION] LOGGING/CAPTURING
 // [SECTION] SETTINGS
+// [SECTION] INPUT RECORDING
+// [SECTION] PROFILER
 // [SECTION] PLATFORM DEPENDENT HELPERS
 // [SECTION] METRICS/DEBUG WINDOW
 
@@ -820,6 +826,9 @@ CODE
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#ifdef IMGUI_ENABLE_PROFILER
+#include <time.h>       // clock_gettime
+#endif
 
 // [Windows] OS specific includes (optional)
 #if defined(_WIN32) && defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
@@ -900,6 +909,9 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS = 4.0f;     // Extend outside and inside windows. Affect FindHoveredWindow().
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certaint time, unless mouse moved.
+static const int   WINDOWS_DRAW_CACHE_STABLE_FRAMES         = 2;        // Frames a window content hash must stay unchanged before End() records its draw list (see SetNextWindowContentHash()).
+// Longest delay after which hovering an item may change its appearance (e.g. tab tooltip and expansion). Affect io.NextFrameDelay.
+static const float HOVERED_ID_VISUAL_DELAY_MAX              = 0.60f;
 
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
@@ -948,9 +960,14 @@ static void             ErrorCheckBeginEndCompareStacksSize(ImGuiWindow* window,
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateInputRecording();
 static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
 static void             UpdateTabFocus();
+static void             UpdateNextFrameDelay();
+#ifdef IMGUI_ENABLE_PROFILER
+static void             ProfilerNewFrame(ImGuiContext* ctx);
+#endif
 static void             UpdateDebugToolItemPicker();
 static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4]);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
@@ -970,7 +987,10 @@ static void             RenderWindowTitleBarContents(ImGuiWindow* window, const
 //    In your debugger, add GImGui to your watch window and notice how its value changes depending on which location you are currently stepping into.
 // 2) Important: Dear ImGui functions are not thread-safe because of this pointer.
 //    If you want thread-safety to allow N threads to access N different contexts, you can:
-//    - Change this variable to use thread local storage so each thread can refer to a different context, in imconfig.h:
+//    - Enable '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in imconfig.h. This pointer is then stored in thread local storage so each thread
+//      can refer to a different context, and each context uses the allocator functions of the thread that created it (see SetAllocatorFunctions()).
+//      A context may only be used by one thread at a time, and shared resources (e.g. a shared ImFontAtlas) need to be synchronized by you.
+//    - Or redirect this variable to your own thread local storage, in imconfig.h:
 //          struct ImGuiContext;
 //          extern thread_local ImGuiContext* MyImGuiTLS;
 //          #define GImGui MyImGuiTLS
@@ -978,12 +998,13 @@ static void             RenderWindowTitleBarContents(ImGuiWindow* window, const
 //    - Future development aim to make this context pointer explicit to all calls. Also read https://github.com/ocornut/imgui/issues/586
 //    - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from different namespace.
 #ifndef GImGui
-ImGuiContext*   GImGui = NULL;
+IMGUI_THREAD_LOCAL ImGuiContext* GImGui = NULL;
 #endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // If you use DLL hotreloading you might need to call SetAllocatorFunctions() after reloading code from this file.
 // Otherwise, you probably don't want to modify them mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
+// With IMGUI_USE_THREAD_LOCAL_CONTEXT, they are per-thread defaults which contexts capture on creation.
 #ifndef IMGUI_DISABLE_DEFAULT_ALLOCATORS
 static void*   MallocWrapper(size_t size, void* user_data)    { IM_UNUSED(user_data); return malloc(size); }
 static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_data); free(ptr); }
@@ -992,9 +1013,9 @@ static void*   MallocWrapper(size_t size, void* user_data)    { IM_UNUSED(user_d
 static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_data); IM_UNUSED(ptr); IM_ASSERT(0); }
 #endif
 
-static void*  (*GImAllocatorAllocFunc)(size_t size, void* user_data) = MallocWrapper;
-static void   (*GImAllocatorFreeFunc)(void* ptr, void* user_data) = FreeWrapper;
-static void*    GImAllocatorUserData = NULL;
+static IMGUI_THREAD_LOCAL void*  (*GImAllocatorAllocFunc)(size_t size, void* user_data) = MallocWrapper;
+static IMGUI_THREAD_LOCAL void   (*GImAllocatorFreeFunc)(void* ptr, void* user_data) = FreeWrapper;
+static IMGUI_THREAD_LOCAL void*    GImAllocatorUserData = NULL;
 
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
@@ -1034,7 +1055,9 @@ ImGuiStyle::ImGuiStyle()
     DisplaySafeAreaPadding  = ImVec2(3,3);      // If you cannot see the edge of your screen (e.g. on a TV) increase the safe area padding. Covers popups/tooltips as well regular windows.
     MouseCursorScale        = 1.0f;             // Scale software rendered mouse cursor (when io.MouseDrawCursor is enabled). May be removed later.
     AntiAliasedLines        = true;             // Enable anti-aliasing on lines/borders. Disable if you are really short on CPU/GPU.
+    AntiAliasedLinesUseTex  = true;             // Enable anti-aliased lines/borders using textures where possible. Require back-end to render with bilinear filtering.
     AntiAliasedFill         = true;             // Enable anti-aliasing on filled shapes (rounded rectangles, circles, etc.)
+    RoundCornersUseTex      = true;             // Enable anti-aliased rounded rectangles and small circles using textures where possible. Require back-end to render with bilinear filtering.
     CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleSegmentMaxError   = 1.60f;            // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -1107,6 +1130,9 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsMemoryCompactTimer = 60.0f;
+    ConfigWindowsStorageGcFrames = 0;
+    ConfigMemoryBudget = 0;
+    ConfigDrawDataHash = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1474,11 +1500,212 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
+// Hash functions
+// - By default we use CRC32 with a 1KB lookup table. This is the historical hash and the one that existing ID values were computed with.
+// - Compile-time enable '#define IMGUI_USE_CRC32C_HASH' in imconfig.h to use CRC32C (Castagnoli polynomial) instead, which maps
+//   onto the SSE4.2 'crc32' instruction on x86/x64 and the ARMv8 CRC32 extension. When the target doesn't have those instructions
+//   (e.g. not compiling with -msse4.2 or -march=armv8-a+crc) we fall back to a table-based CRC32C producing identical values,
+//   so IDs are stable across platforms within a given configuration.
+// - The hardware path hashes 8 bytes at a time and locates '#' (for the "###" operator) and the zero terminator with a SIMD/SWAR
+//   byte search, so labels without '#' never take the per-byte path.
+#if defined(IMGUI_USE_CRC32C_HASH) && (defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__)))
+#include <nmmintrin.h>      // _mm_crc32_u8, _mm_crc32_u64 (SSE4.2), _mm_cmpeq_epi8 (SSE2)
+#ifdef _MSC_VER
+#include <intrin.h>         // _BitScanForward
+#endif
+#define IMGUI_HASH_CRC32C_SSE42
+#elif defined(IMGUI_USE_CRC32C_HASH) && defined(__ARM_FEATURE_CRC32) && defined(__aarch64__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_acle.h>       // __crc32cb, __crc32cw, __crc32cd
+#define IMGUI_HASH_CRC32C_ARM
+#endif
+
+#if defined(IMGUI_HASH_CRC32C_SSE42) || defined(IMGUI_HASH_CRC32C_ARM)
+
+// Our zero-terminated search reads whole aligned blocks, which may extend past the terminator but never crosses a page boundary.
+// Those reads are safe in practice (this is what every optimized strlen() does) but would be reported by AddressSanitizer.
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define IM_HASH_NO_SANITIZE __attribute__((no_sanitize_address))
+#endif
+#elif defined(__SANITIZE_ADDRESS__)
+#define IM_HASH_NO_SANITIZE __attribute__((no_sanitize_address))
+#endif
+#ifndef IM_HASH_NO_SANITIZE
+#define IM_HASH_NO_SANITIZE
+#endif
+
+// Index of lowest set bit. SSE path uses 16-bit byte masks, SWAR path (GCC/Clang only) uses 64-bit masks with 8 bits per byte.
+#ifdef IMGUI_HASH_CRC32C_SSE42
+static inline int ImHashFindFirstByte(int mask)
+{
+#ifdef _MSC_VER
+    unsigned long n;
+    _BitScanForward(&n, (unsigned long)mask);
+    return (int)n;
+#else
+    return __builtin_ctz((unsigned int)mask);
+#endif
+}
+#else
+static inline int ImHashFindFirstByte(ImU64 mask) { return __builtin_ctzll(mask) >> 3; }
+#endif
+
+#ifdef IMGUI_HASH_CRC32C_SSE42
+static inline ImU32 ImCrc32cU8(ImU32 crc, unsigned char c)  { return _mm_crc32_u8(crc, c); }
+#if defined(__x86_64__) || defined(_M_X64)
+static inline ImU32 ImCrc32cU64(ImU32 crc, ImU64 v)         { return (ImU32)_mm_crc32_u64(crc, v); }
+#else
+static inline ImU32 ImCrc32cU64(ImU32 crc, ImU64 v)         { return _mm_crc32_u32(_mm_crc32_u32(crc, (ImU32)v), (ImU32)(v >> 32)); }
+#endif
+#else
+static inline ImU32 ImCrc32cU8(ImU32 crc, unsigned char c)  { return __crc32cb(crc, c); }
+static inline ImU32 ImCrc32cU64(ImU32 crc, ImU64 v)         { return __crc32cd(crc, v); }
+#endif
+
+// Hash a block of bytes known not to contain any special character
+static inline ImU32 ImCrc32cBlock(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = ImCrc32cU64(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = ImCrc32cU8(crc, *data++);
+    return crc;
+}
+
+// Return pointer to first '#' within [data, data_end), or data_end
+static inline const unsigned char* ImHashFindSharp(const unsigned char* data, const unsigned char* data_end)
+{
+#ifdef IMGUI_HASH_CRC32C_SSE42
+    const __m128i sharp = _mm_set1_epi8('#');
+    for (; data + 16 <= data_end; data += 16)
+        if (int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(const void*)data), sharp)))
+            return data + ImHashFindFirstByte(mask);
+#else
+    const ImU64 lo = 0x0101010101010101ULL, hi = 0x8080808080808080ULL, sharp = lo * '#';
+    for (; data + 8 <= data_end; data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        v ^= sharp;
+        if (ImU64 mask = (v - lo) & ~v & hi)
+            return data + ImHashFindFirstByte(mask);
+    }
+#endif
+    while (data < data_end && *data != '#')
+        data++;
+    return data;
+}
+
+// Return pointer to first '#' or zero terminator
+// We read whole blocks which may extend past the terminator, but never across a page boundary: the first block is read unaligned
+// only if it doesn't straddle two pages, after which we continue with aligned blocks.
+#ifdef IMGUI_HASH_CRC32C_SSE42
+typedef int ImHashBlockMask;
+static const int IM_HASH_BLOCK_SIZE = 16;
+IM_HASH_NO_SANITIZE static inline ImHashBlockMask ImHashFindSharpOrZeroInBlock(const unsigned char* data)
+{
+    const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)data);
+    return _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_setzero_si128()), _mm_cmpeq_epi8(v, _mm_set1_epi8('#'))));
+}
+#else
+typedef ImU64 ImHashBlockMask;
+static const int IM_HASH_BLOCK_SIZE = 8;
+IM_HASH_NO_SANITIZE static inline ImHashBlockMask ImHashFindSharpOrZeroInBlock(const unsigned char* data)
+{
+    const ImU64 lo = 0x0101010101010101ULL, hi = 0x8080808080808080ULL, sharp = lo * '#';
+    ImU64 v;
+    memcpy(&v, data, 8);
+    const ImU64 vs = v ^ sharp;
+    return (((v - lo) & ~v) | ((vs - lo) & ~vs)) & hi;
+}
+#endif
+
+IM_HASH_NO_SANITIZE static inline const unsigned char* ImHashFindSharpOrZero(const unsigned char* data)
+{
+    const size_t page_size = 4096;
+    if (((size_t)data & (page_size - 1)) <= page_size - IM_HASH_BLOCK_SIZE)
+    {
+        if (ImHashBlockMask mask = ImHashFindSharpOrZeroInBlock(data))
+            return data + ImHashFindFirstByte(mask);
+        data = (const unsigned char*)(((size_t)data + IM_HASH_BLOCK_SIZE) & ~(size_t)(IM_HASH_BLOCK_SIZE - 1));
+    }
+    else
+    {
+        for (; ((size_t)data & (IM_HASH_BLOCK_SIZE - 1)) != 0; data++)
+            if (*data == 0 || *data == '#')
+                return data;
+    }
+    for (;; data += IM_HASH_BLOCK_SIZE)
+        if (ImHashBlockMask mask = ImHashFindSharpOrZeroInBlock(data))
+            return data + ImHashFindFirstByte(mask);
+}
+
+// Multiply by x^32 modulo the CRC polynomial
+#ifdef IMGUI_HASH_CRC32C_SSE42
+static inline ImU32 ImHashShift32(ImU32 crc)                { return _mm_crc32_u32(0, crc); }
+#else
+static inline ImU32 ImHashShift32(ImU32 crc)                { return __crc32cw(0, crc); }
+#endif
+
+// Known size hash
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    return ~ImCrc32cBlock(~seed, (const unsigned char*)data_p, data_size);
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+// Produces the same values as the table-based CRC32C version below.
+ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+{
+    seed = ~seed;
+    ImU32 crc = seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    if (data_size != 0)
+    {
+        const unsigned char* data_end = data + data_size;
+        for (;;)
+        {
+            const unsigned char* sharp = ImHashFindSharp(data, data_end);
+            crc = ImCrc32cBlock(crc, data, (size_t)(sharp - data));
+            if (sharp == data_end)
+                break;
+            if (data_end - sharp >= 3 && sharp[1] == '#' && sharp[2] == '#')
+                crc = seed;
+            crc = ImCrc32cU8(crc, '#');
+            data = sharp + 1;
+        }
+    }
+    else
+    {
+        for (;;)
+        {
+            const unsigned char* sharp = ImHashFindSharpOrZero(data);
+            crc = ImCrc32cBlock(crc, data, (size_t)(sharp - data));
+            if (*sharp == 0)
+                break;
+            if (sharp[1] == '#' && sharp[2] == '#')
+                crc = seed;
+            crc = ImCrc32cU8(crc, '#');
+            data = sharp + 1;
+        }
+    }
+    return ~crc;
+}
+
+#else // #if defined(IMGUI_HASH_CRC32C_SSE42) || defined(IMGUI_HASH_CRC32C_ARM)
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
 static const ImU32 GCrc32LookupTable[256] =
 {
+#ifndef IMGUI_USE_CRC32C_HASH
     0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
     0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
     0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
@@ -1495,11 +1722,29 @@ static const ImU32 GCrc32LookupTable[256] =
     0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
     0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
+#else
+    0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+    0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+    0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+    0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+    0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+    0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+    0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+    0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+    0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+    0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+    0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+    0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+    0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+    0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+    0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+    0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+#endif
 };
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// FIXME-OPT: CRC32 pretty much randomly access 1KB. See IMGUI_USE_CRC32C_HASH for a faster alternative.
 ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
@@ -1515,7 +1760,7 @@ ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// FIXME-OPT: CRC32 pretty much randomly access 1KB. See IMGUI_USE_CRC32C_HASH for a faster alternative.
 ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
@@ -1544,6 +1789,70 @@ ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+
+// Multiply by x^32 modulo the CRC polynomial
+static inline ImU32 ImHashShift32(ImU32 crc)
+{
+    const ImU32* crc32_lut = GCrc32LookupTable;
+    for (int n = 0; n < 4; n++)
+        crc = (crc >> 8) ^ crc32_lut[crc & 0xFF];
+    return crc;
+}
+
+#endif // #if defined(IMGUI_HASH_CRC32C_SSE42) || defined(IMGUI_HASH_CRC32C_ARM)
+
+// Carry-less 32x32->64 multiply, using PCLMULQDQ when available.
+// The portable version uses integer multiplies on bits spread 4 apart, so carries never reach a bit we keep. (from BearSSL)
+#if defined(__PCLMUL__) && (defined(__x86_64__) || defined(_M_X64))
+#include <wmmintrin.h>      // _mm_clmulepi64_si128
+static inline ImU64 ImCarrylessMul32(ImU32 a, ImU32 b)
+{
+    return (ImU64)_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_cvtsi32_si128((int)a), _mm_cvtsi32_si128((int)b), 0x00));
+}
+#else
+static inline ImU64 ImCarrylessMul32(ImU32 a, ImU32 b)
+{
+    const ImU64 a0 = a & 0x11111111u, a1 = a & 0x22222222u, a2 = a & 0x44444444u, a3 = a & 0x88888888u;
+    const ImU64 b0 = b & 0x11111111u, b1 = b & 0x22222222u, b2 = b & 0x44444444u, b3 = b & 0x88888888u;
+    const ImU64 r0 = (a0 * b0) ^ (a1 * b3) ^ (a2 * b2) ^ (a3 * b1);
+    const ImU64 r1 = (a0 * b1) ^ (a1 * b0) ^ (a2 * b3) ^ (a3 * b2);
+    const ImU64 r2 = (a0 * b2) ^ (a1 * b1) ^ (a2 * b0) ^ (a3 * b3);
+    const ImU64 r3 = (a0 * b3) ^ (a1 * b2) ^ (a2 * b1) ^ (a3 * b0);
+    return (r0 & 0x1111111111111111ULL) | (r1 & 0x2222222222222222ULL) | (r2 & 0x4444444444444444ULL) | (r3 & 0x8888888888888888ULL);
+}
+#endif
+
+// Combine a label hashed at compile-time with a runtime seed. Equivalent to ImHashStr(label.Str, 0, seed).
+// In CRC bit order, the 64-bit product of seed and ShiftK (== x^(8*len-1)) is seed*x^(8*len) spread over two 32-bit halves:
+// the low half needs to be multiplied by x^32 modulo the polynomial, the high half is already reduced.
+ImU32 ImHashStrCombine(ImU32 seed, const ImGuiIDLiteral& label)
+{
+    if (label.ShiftK == 0)
+        return ImHashStr(label.Str, 0, seed);
+    const ImU64 product = ImCarrylessMul32(seed, label.ShiftK);
+    return label.Hash ^ ImHashShift32((ImU32)product) ^ (ImU32)(product >> 32);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (Atomics)
+//-----------------------------------------------------------------------------
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>         // _InterlockedExchangeAdd
+#endif
+
+int ImAtomicAdd(int* p, int v)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    IM_STATIC_ASSERT(sizeof(long) == sizeof(int));
+    return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v) + v;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __sync_add_and_fetch(p, v);
+#else
+    return (*p += v);   // Not atomic: don't share data between threads on this compiler
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -1962,7 +2271,10 @@ int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_i;
 }
 
@@ -1975,7 +2287,10 @@ float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_f;
 }
 
@@ -1983,7 +2298,10 @@ void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_p;
 }
 
@@ -1993,6 +2311,7 @@ void ImGuiStorage::SetInt(ImGuiID key, int val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -2009,6 +2328,7 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -2020,6 +2340,7 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -2032,6 +2353,198 @@ void ImGuiStorage::SetAllInt(int v)
         Data[i].val_i = v;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiHashStorage
+// Helper: Open-addressing Key->value storage (declared in imgui_internal.h)
+//-----------------------------------------------------------------------------
+
+// Keys are generally already hashed, but user-provided integer IDs may not be, so we mix them a little before masking.
+static inline int ImHashStorageSlot(ImGuiID key, int slot_mask)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return (int)((h ^ (h >> 15)) & (ImU32)slot_mask);
+}
+
+void ImGuiHashStorage::Reserve(int key_count)
+{
+    const int slot_count = ImUpperPowerOfTwo(ImMax(key_count * 2, 16));
+    if (slot_count > Data.Size)
+        Rehash(slot_count);
+}
+
+void ImGuiHashStorage::Rehash(int slot_count)
+{
+    IM_ASSERT(ImIsPowerOfTwo(slot_count) && slot_count > Count * 2);
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
+    ImVector<ImGuiStoragePair> old_data;
+    old_data.swap(Data);
+    Data.resize(slot_count);
+    memset(Data.Data, 0, (size_t)Data.Size * sizeof(ImGuiStoragePair));
+    const int slot_mask = slot_count - 1;
+    for (int n = 0; n < old_data.Size; n++)
+        if (old_data[n].key != 0)
+        {
+            int slot = ImHashStorageSlot(old_data[n].key, slot_mask);
+            while (Data[slot].key != 0)
+                slot = (slot + 1) & slot_mask;
+            Data[slot] = old_data[n];
+        }
+}
+
+const ImGuiHashStorage::ImGuiStoragePair* ImGuiHashStorage::FindPair(ImGuiID key) const
+{
+    if (key == 0)
+        return ZeroKeyUsed ? &ZeroKeyPair : NULL;
+    if (Count == 0)
+        return NULL;
+    const int slot_mask = Data.Size - 1;
+    for (int slot = ImHashStorageSlot(key, slot_mask); Data.Data[slot].key != 0; slot = (slot + 1) & slot_mask)
+        if (Data.Data[slot].key == key)
+            return &Data.Data[slot];
+    return NULL;
+}
+
+ImGuiHashStorage::ImGuiStoragePair* ImGuiHashStorage::FindOrAddPair(ImGuiID key, bool* p_added)
+{
+    *p_added = false;
+    if (key == 0)
+    {
+        if (!ZeroKeyUsed)
+            *p_added = ZeroKeyUsed = true;
+        return &ZeroKeyPair;
+    }
+    if (ImGuiStoragePair* it = const_cast<ImGuiStoragePair*>(FindPair(key)))
+        return it;
+    if ((Count + 1) * 2 > Data.Size)
+        Rehash(ImMax(Data.Size * 2, 16));
+    const int slot_mask = Data.Size - 1;
+    int slot = ImHashStorageSlot(key, slot_mask);
+    while (Data.Data[slot].key != 0)
+        slot = (slot + 1) & slot_mask;
+    Data.Data[slot].key = key;
+    Count++;
+    *p_added = true;
+    return &Data.Data[slot];
+}
+
+void ImGuiHashStorage::SetAllInt(int v)
+{
+    for (int i = 0; i < Data.Size; i++)
+        if (Data[i].key != 0)
+            Data[i].val_i = v;
+    ZeroKeyPair.val_i = v;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImLinearArena
+//-----------------------------------------------------------------------------
+
+static const int ARENA_BLOCK_SIZE_MAX       = 1024 * 1024;  // Larger allocations are always made on the heap, and the block never grows past this size.
+static const int ARENA_SHRINK_RESETS_COUNT  = 600;          // Number of Reset() (frames) over which the peak usage is measured before the block may shrink.
+
+void* ImLinearArena::Alloc(size_t size)
+{
+    if (size > (size_t)ARENA_BLOCK_SIZE_MAX)
+    {
+        void* ptr = IM_ALLOC(size);
+        OverflowAllocs.push_back(ptr);
+        return ptr;
+    }
+    const int aligned_size = (int)((size + 15) & ~(size_t)15);
+    TotalSize += aligned_size;
+    if (BlockSize + aligned_size <= BlockCapacity)
+    {
+        void* ptr = Block + BlockSize;
+        BlockSize += aligned_size;
+        return ptr;
+    }
+    void* ptr = IM_ALLOC((size_t)aligned_size);
+    OverflowAllocs.push_back(ptr);
+    return ptr;
+}
+
+void ImLinearArena::Reset()
+{
+    for (int n = 0; n < OverflowAllocs.Size; n++)
+        IM_FREE(OverflowAllocs[n]);
+    OverflowAllocs.resize(0);
+
+    // Grow the block so that the same amount of data fits in it next time.
+    // Shrink it when the peak usage of the last ARENA_SHRINK_RESETS_COUNT frames was less than a quarter of it, so a single spike doesn't hold memory forever.
+    PeakSize = ImMax(PeakSize, TotalSize);
+    int new_capacity = BlockCapacity;
+    if (TotalSize > BlockCapacity)
+    {
+        new_capacity = ImMin(ImUpperPowerOfTwo(ImMax(TotalSize, 1024)), ARENA_BLOCK_SIZE_MAX);
+        PeakSize = PeakResetsCount = 0;
+    }
+    else if (++PeakResetsCount >= ARENA_SHRINK_RESETS_COUNT)
+    {
+        if (PeakSize * 4 <= BlockCapacity)
+            new_capacity = (PeakSize > 0) ? ImUpperPowerOfTwo(ImMax(PeakSize, 1024)) : 0;
+        PeakSize = PeakResetsCount = 0;
+    }
+    if (new_capacity != BlockCapacity)
+    {
+        if (Block)
+            IM_FREE(Block);
+        Block = (new_capacity > 0) ? (char*)IM_ALLOC((size_t)new_capacity) : NULL;
+        BlockCapacity = new_capacity;
+    }
+    BlockSize = TotalSize = 0;
+}
+
+void ImLinearArena::Clear()
+{
+    for (int n = 0; n < OverflowAllocs.Size; n++)
+        IM_FREE(OverflowAllocs[n]);
+    OverflowAllocs.clear();
+    if (Block)
+        IM_FREE(Block);
+    Block = NULL;
+    BlockSize = BlockCapacity = TotalSize = PeakSize = PeakResetsCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImSlabAllocator
+//-----------------------------------------------------------------------------
+
+void* ImSlabAllocator::Alloc()
+{
+    IM_ASSERT(ItemSize > 0 && ItemsPerSlab > 0);   // Call Init() first
+    ItemsCount++;
+    if (FreeList != NULL)
+    {
+        void* ptr = FreeList;
+        FreeList = *(void**)ptr;
+        return ptr;
+    }
+    if (Slabs.Size == 0 || SlabUsed == ItemsPerSlab)
+    {
+        Slabs.push_back(IM_ALLOC((size_t)ItemsPerSlab * ItemSize));
+        SlabUsed = 0;
+    }
+    return (char*)Slabs.back() + (SlabUsed++) * ItemSize;
+}
+
+void ImSlabAllocator::Free(void* ptr)
+{
+    IM_ASSERT(ptr != NULL && ItemsCount > 0);
+    ItemsCount--;
+    *(void**)ptr = FreeList;
+    FreeList = ptr;
+}
+
+void ImSlabAllocator::Clear()
+{
+    IM_ASSERT(ItemsCount == 0);     // Items must have been freed
+    for (int n = 0; n < Slabs.Size; n++)
+        IM_FREE(Slabs[n]);
+    Slabs.clear();
+    SlabUsed = 0;
+    FreeList = NULL;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextFilter
 //-----------------------------------------------------------------------------
@@ -2874,14 +3387,13 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
 
     MemoryCompacted = false;
     MemoryDrawListIdxCapacity = MemoryDrawListVtxCapacity = 0;
+    StateStorageGcTime = 0.0f;
 }
 
 ImGuiWindow::~ImGuiWindow()
 {
     IM_ASSERT(DrawList == &DrawListInst);
     IM_DELETE(Name);
-    for (int i = 0; i != ColumnsStorage.Size; i++)
-        ColumnsStorage[i].~ImGuiColumns();
 }
 
 ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
@@ -2908,6 +3420,14 @@ ImGuiID ImGuiWindow::GetID(int n)
     return id;
 }
 
+ImGuiID ImGuiWindow::GetID(const ImGuiIDLiteral& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashStrCombine(seed, label);
+    ImGui::KeepAliveID(id);
+    return id;
+}
+
 ImGuiID ImGuiWindow::GetIDNoKeepAlive(const char* str, const char* str_end)
 {
     ImGuiID seed = IDStack.back();
@@ -2957,6 +3477,7 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->ClearFreeMemory();
+    window->DrawCache.ClearFreeMemory();
     window->DC.ChildWindows.clear();
     window->DC.ItemFlagsStack.clear();
     window->DC.ItemWidthStack.clear();
@@ -2974,6 +3495,227 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+// Record the use of a StateStorage entry, when io.ConfigWindowsStorageGcFrames > 0. Only recorded entries may be removed
+// by GcCompactStateStorage(), so entries written with GetStateStorage() by user code are preserved.
+// The value stores the frame number (29 bits, ages are computed modulo 2^29), the default value (0/1) and whether the entry
+// may be removed when equal to its default.
+void ImGui::GcMarkStateStorageUsed(ImGuiWindow* window, ImGuiID key, int default_val, bool remove_if_default)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(default_val == 0 || default_val == 1);
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
+    window->StateStorageUsage.SetInt(key, ((g.FrameCount & 0x1FFFFFFF) << 2) | (default_val << 1) | (remove_if_default ? 1 : 0));
+}
+
+// Remove the recorded StateStorage entries unused for io.ConfigWindowsStorageGcFrames frames, or equal to their default value.
+// Return the number of removed entries.
+int ImGui::GcCompactStateStorage(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    window->StateStorageGcTime = (float)g.Time;
+    ImGuiHashStorage& usage = window->StateStorageUsage;
+    if (usage.GetSize() == 0)
+        return 0;
+
+    // Entries are removed in place, which keeps them sorted. The usage map is rebuilt with the remaining entries,
+    // which also drops the usage of entries removed by other means.
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Storage);
+    ImVector<ImGuiStorage::ImGuiStoragePair>& data = window->StateStorage.Data;
+    ImGuiHashStorage new_usage;
+    const int max_age = g.IO.ConfigWindowsStorageGcFrames;
+    int dst_n = 0;
+    for (int src_n = 0; src_n < data.Size; src_n++)
+    {
+        const ImGuiStorage::ImGuiStoragePair& pair = data[src_n];
+        const int info = usage.GetInt(pair.key, -1);
+        if (info != -1)
+        {
+            const int age = (g.FrameCount - ((info >> 2) & 0x1FFFFFFF)) & 0x1FFFFFFF;
+            const int default_val = (info >> 1) & 1;
+            const bool remove_if_default = (info & 1) != 0;
+            if (age > max_age || (remove_if_default && pair.val_i == default_val))
+                continue;
+            new_usage.SetInt(pair.key, info);
+        }
+        data[dst_n++] = pair;
+    }
+    const int removed_count = data.Size - dst_n;
+    data.resize(dst_n);
+    usage.swap(new_usage);
+    g.MemoryBudgetStats.StorageEntries += removed_count;
+    return removed_count;
+}
+
+// Memory budget (see io.ConfigMemoryBudget)
+// - The memory usage is measured when IMGUI_ENABLE_ALLOC_TRACKING is enabled (excluding fonts, which may be shared and can't be reclaimed),
+//   otherwise estimated from the capacity of the buffers which grow with the contents: window draw lists, draw caches, state storage,
+//   columns, tab bars and text input.
+// - When over budget, we release the InputText() buffers if inactive, then compact windows which were not submitted last frame
+//   in least recently used order until under budget, then trim tab bars not visible last frame.
+// - When that is not enough (the rest of the usage can't be reclaimed), we don't try again until the usage grows by 1/16th of the budget
+//   or other windows become inactive.
+template<typename T>
+static int GcCalcVectorBytes(const ImVector<T>& v)
+{
+    return v.Capacity * (int)sizeof(T);
+}
+
+// Reallocate a vector to fit its size, return the number of bytes released
+template<typename T>
+static int GcShrinkVector(ImVector<T>* v)
+{
+    const int bytes_before = GcCalcVectorBytes(*v);
+    if (v->Capacity == v->Size)
+        return 0;
+    if (v->Size == 0)
+    {
+        v->clear();
+        return bytes_before;
+    }
+    ImVector<T> copy;
+    copy.reserve(v->Size);
+    copy.Size = v->Size;
+    memcpy(copy.Data, v->Data, (size_t)v->Size * sizeof(T));
+    v->swap(copy);
+    return bytes_before - GcCalcVectorBytes(*v);
+}
+
+static int GcCalcSplitterMemoryUsage(const ImDrawListSplitter& splitter)
+{
+    int bytes = GcCalcVectorBytes(splitter._Channels);
+    for (int n = 0; n < splitter._Channels.Size; n++)
+        bytes += GcCalcVectorBytes(splitter._Channels[n]._CmdBuffer) + GcCalcVectorBytes(splitter._Channels[n]._IdxBuffer);
+    return bytes;
+}
+
+static int GcCalcWindowDrawListsMemoryUsage(ImGuiWindow* window)
+{
+    const ImDrawList* draw_list = window->DrawList;
+    int bytes = GcCalcVectorBytes(draw_list->CmdBuffer) + GcCalcVectorBytes(draw_list->IdxBuffer) + GcCalcVectorBytes(draw_list->VtxBuffer);
+    bytes += GcCalcVectorBytes(draw_list->_ClipRectStack) + GcCalcVectorBytes(draw_list->_TextureIdStack) + GcCalcVectorBytes(draw_list->_Path);
+    bytes += GcCalcSplitterMemoryUsage(draw_list->_Splitter);
+    bytes += GcCalcVectorBytes(window->DrawCache.CmdBuffer) + GcCalcVectorBytes(window->DrawCache.IdxBuffer) + GcCalcVectorBytes(window->DrawCache.VtxBuffer);
+    return bytes;
+}
+
+static int GcCalcWindowColumnsMemoryUsage(ImGuiWindow* window)
+{
+    int bytes = window->ColumnsStorage.GetCapacity() * (int)sizeof(ImGuiColumns);
+    for (int n = 0; n < window->ColumnsStorage.GetSize(); n++)
+        bytes += GcCalcVectorBytes(window->ColumnsStorage.GetByIndex(n)->Columns) + GcCalcSplitterMemoryUsage(window->ColumnsStorage.GetByIndex(n)->Splitter);
+    return bytes;
+}
+
+int ImGui::GcCalcMemoryUsage()
+{
+    ImGuiContext& g = *GImGui;
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    return g.MemAllocStats[ImGuiMemAllocTag_COUNT].LiveBytes - g.MemAllocStats[ImGuiMemAllocTag_Fonts].LiveBytes;
+#else
+    int bytes = GcCalcVectorBytes(g.InputTextState.TextW) + GcCalcVectorBytes(g.InputTextState.TextA) + GcCalcVectorBytes(g.InputTextState.InitialTextA);
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        bytes += (int)sizeof(ImGuiWindow) + GcCalcWindowDrawListsMemoryUsage(window) + GcCalcWindowColumnsMemoryUsage(window);
+        bytes += GcCalcVectorBytes(window->StateStorage.Data) + window->IDStack.heap_size_in_bytes() + GcCalcVectorBytes(window->DC.ChildWindows);
+    }
+    for (int n = 0; n < g.TabBars.GetSize(); n++)
+        if (ImGuiTabBar* tab_bar = g.TabBars.GetByIndex(n))
+            bytes += (int)sizeof(ImGuiTabBar) + GcCalcVectorBytes(tab_bar->Tabs) + GcCalcVectorBytes(tab_bar->TabsNames.Buf);
+    return bytes;
+#endif
+}
+
+static int IMGUI_CDECL GcWindowComparerByLastTimeActive(const void* lhs, const void* rhs)
+{
+    const float lhs_time = (*(const ImGuiWindow* const*)lhs)->LastTimeActive;
+    const float rhs_time = (*(const ImGuiWindow* const*)rhs)->LastTimeActive;
+    return (lhs_time < rhs_time) ? -1 : (lhs_time > rhs_time) ? +1 : 0;
+}
+
+// Called by NewFrame() when io.ConfigMemoryBudget > 0, after marking all windows as inactive
+void ImGui::GcEnforceMemoryBudget()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMemoryBudgetStats& stats = g.MemoryBudgetStats;
+    int usage = GcCalcMemoryUsage();
+    const int budget = g.IO.ConfigMemoryBudget;
+    const int reclaimed_start = stats.GetTotal();
+
+    // Windows which were not submitted last frame and are not already compacted
+    // (test LastFrameActive rather than WasActive, which is cleared for the implicit "Debug" window when unused)
+    ImVector<ImGuiWindow*>& windows = g.MemoryBudgetWindows;
+    windows.resize(0);
+    if (usage > budget)
+        for (int n = 0; n < g.Windows.Size; n++)
+            if (g.Windows[n]->LastFrameActive < g.FrameCount - 1 && !g.Windows[n]->MemoryCompacted)
+                windows.push_back(g.Windows[n]);
+
+    // Back off after a pass which couldn't get under budget, until the usage grows or windows become inactive
+    if (usage <= budget)
+        g.MemoryBudgetBackoffUsage = 0;
+    else if (g.MemoryBudgetBackoffUsage == 0 || usage > g.MemoryBudgetBackoffUsage + budget / 16 || windows.Size > 0)
+    {
+        // Text input buffers, unless a text input is active
+        ImGuiInputTextState& input_state = g.InputTextState;
+        if (g.ActiveId == 0 || g.ActiveId != input_state.ID)
+        {
+            const int bytes = GcCalcVectorBytes(input_state.TextW) + GcCalcVectorBytes(input_state.TextA) + GcCalcVectorBytes(input_state.InitialTextA);
+            if (bytes > 0)
+            {
+                input_state.ClearFreeMemory();
+                input_state.ID = 0;             // Reinitialize the state if the same text input becomes active again
+                stats.InputText += bytes;
+                usage -= bytes;
+            }
+        }
+
+        // Compact windows, least recently used first
+        if (windows.Size > 1)
+            ImQsort(windows.Data, (size_t)windows.Size, sizeof(ImGuiWindow*), GcWindowComparerByLastTimeActive);
+        for (int n = 0; n < windows.Size && usage > budget; n++)
+        {
+            ImGuiWindow* window = windows[n];
+            int bytes_draw_lists = GcCalcWindowDrawListsMemoryUsage(window), bytes_columns = 0, bytes_storage = 0;
+            GcCompactTransientWindowBuffers(window);
+            bytes_draw_lists -= GcCalcWindowDrawListsMemoryUsage(window);
+            stats.CompactedWindows++;
+            for (int columns_n = 0; columns_n < window->ColumnsStorage.GetSize(); columns_n++)
+            {
+                ImGuiColumns& columns = *window->ColumnsStorage.GetByIndex(columns_n);
+                bytes_columns += GcCalcSplitterMemoryUsage(columns.Splitter);
+                columns.Splitter.ClearFreeMemory();
+                bytes_columns += GcShrinkVector(&columns.Columns);
+            }
+            if (g.IO.ConfigWindowsStorageGcFrames > 0)
+                GcCompactStateStorage(window);
+            bytes_storage += GcShrinkVector(&window->StateStorage.Data);
+            stats.DrawLists += bytes_draw_lists;
+            stats.Columns += bytes_columns;
+            stats.Storage += bytes_storage;
+            usage -= bytes_draw_lists + bytes_columns + bytes_storage;
+        }
+
+        // Tab bars which were not visible last frame
+        for (int n = 0; n < g.TabBars.GetSize() && usage > budget; n++)
+            if (ImGuiTabBar* tab_bar = g.TabBars.GetByIndex(n))
+                if (tab_bar->CurrFrameVisible < g.FrameCount - 1)
+                {
+                    const int bytes = GcShrinkVector(&tab_bar->Tabs) + GcShrinkVector(&tab_bar->TabsNames.Buf);
+                    stats.TabBars += bytes;
+                    usage -= bytes;
+                }
+
+        g.MemoryBudgetBackoffUsage = (usage > budget) ? usage : 0;
+    }
+
+    const int reclaimed = stats.GetTotal() - reclaimed_start;
+    if (reclaimed > 0)
+        stats.LastFrame = g.FrameCount;
+    g.IO.MetricsMemoryReclaimed += reclaimed;
+    g.IO.MetricsMemoryUsage = (reclaimed > 0) ? GcCalcMemoryUsage() : usage;
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -3214,23 +3956,138 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+// Each allocation is prefixed with a header storing its size, tag and owner context, so MemFree() can update the statistics.
+// 16 bytes to preserve the alignment guaranteed by the underlying allocator.
+struct ImGuiMemAllocHeader
+{
+    union { ImGuiContext* Context; ImU64 ContextPadding; };  // Context the allocation was accounted to (no context may be current when allocating). Padded to 8 bytes for 32-bit targets.
+    int     Size;
+    int     Tag;
+};
+IM_STATIC_ASSERT(sizeof(ImGuiMemAllocHeader) == 16);
+
+static IMGUI_THREAD_LOCAL ImGuiMemAllocTag GImAllocatorTag = ImGuiMemAllocTag_Misc;
+
+static void* MemAllocTrack(ImGuiContext* ctx, void* block, size_t size)
+{
+    if (block == NULL)
+        return NULL;
+    IM_ASSERT(size <= INT_MAX && "Allocation too large for the tracking statistics!");
+    ImGuiMemAllocHeader* header = (ImGuiMemAllocHeader*)block;
+    header->ContextPadding = 0;
+    header->Context = ctx;
+    header->Size = (int)size;
+    header->Tag = GImAllocatorTag;
+    if (ctx)
+    {
+        // Update subsystem and total statistics.
+        // Atomic as ImDrawList may allocate from other threads. PeakBytes is only approximate when that happens.
+        ImGuiMemAllocStats* stats_list[2] = { &ctx->MemAllocStats[header->Tag], &ctx->MemAllocStats[ImGuiMemAllocTag_COUNT] };
+        for (int n = 0; n < 2; n++)
+        {
+            ImGuiMemAllocStats& stats = *stats_list[n];
+            const int live_bytes = ImAtomicAdd(&stats.LiveBytes, header->Size);
+            if (stats.PeakBytes < live_bytes)
+                stats.PeakBytes = live_bytes;
+            ImAtomicAdd(&stats.LiveCount, +1);
+            ImAtomicAdd(&stats.CurrFrameAllocCount, +1);
+            ImAtomicAdd(&stats.CurrFrameAllocBytes, header->Size);
+        }
+    }
+    return header + 1;
+}
+
+static void* MemFreeTrack(ImGuiContext* ctx, void* ptr)
+{
+    // Only update the statistics of the context which accounted the allocation: memory may be freed while another context is current.
+    ImGuiMemAllocHeader* header = (ImGuiMemAllocHeader*)ptr - 1;
+    if (ctx && header->Context == ctx)
+    {
+        ImGuiMemAllocStats* stats_list[2] = { &ctx->MemAllocStats[header->Tag], &ctx->MemAllocStats[ImGuiMemAllocTag_COUNT] };
+        for (int n = 0; n < 2; n++)
+        {
+            ImAtomicAdd(&stats_list[n]->LiveBytes, -header->Size);
+            ImAtomicAdd(&stats_list[n]->LiveCount, -1);
+        }
+    }
+    return header;
+}
+#endif
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
-        ctx->IO.MetricsActiveAllocations++;
-    return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+    ImGuiContext* ctx = GImGui;
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    const size_t block_size = size + sizeof(ImGuiMemAllocHeader);
+#else
+    const size_t block_size = size;
+#endif
+    void* block;
+    if (ctx)
+    {
+        ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, +1);   // Atomic as ImDrawList may allocate from other threads (see SetupDetachedDrawList())
+        ImAtomicAdd(&ctx->FrameAllocationsCount, +1);
+    }
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    if (ctx && ctx->MemAllocFunc)
+        block = ctx->MemAllocFunc(block_size, ctx->MemAllocatorUserData);
+    else
+#endif
+        block = GImAllocatorAllocFunc(block_size, GImAllocatorUserData);
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    return MemAllocTrack(ctx, block, size);
+#else
+    return block;
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
 void ImGui::MemFree(void* ptr)
 {
+    ImGuiContext* ctx = ptr ? GImGui : NULL;
+    if (ctx)
+        ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, -1);
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
     if (ptr)
-        if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
+        ptr = MemFreeTrack(ctx, ptr);
+#endif
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    if (ctx && ctx->MemFreeFunc)
+        return ctx->MemFreeFunc(ptr, ctx->MemAllocatorUserData);
+#endif
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+ImGuiMemAllocTag ImGui::SetMemAllocTag(ImGuiMemAllocTag tag)
+{
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemAllocTag_COUNT);
+    ImGuiMemAllocTag prev_tag = GImAllocatorTag;
+    GImAllocatorTag = tag;
+    return prev_tag;
+#else
+    IM_UNUSED(tag);
+    return ImGuiMemAllocTag_Misc;
+#endif
+}
+
+const ImGuiMemAllocStats* ImGui::GetMemAllocStats(ImGuiMemAllocTag tag)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(tag >= 0 && tag <= ImGuiMemAllocTag_COUNT);
+    return &g.MemAllocStats[tag];
+}
+
+static const char* const GMemAllocTagNames[] = { "Misc", "DrawLists", "Fonts", "TextEdit", "Storage", "Settings", "Windows", "Columns", "TabBars" };
+IM_STATIC_ASSERT(IM_ARRAYSIZE(GMemAllocTagNames) == ImGuiMemAllocTag_COUNT);
+
+const char* ImGui::GetMemAllocTagName(ImGuiMemAllocTag tag)
+{
+    return (tag >= 0 && tag < ImGuiMemAllocTag_COUNT) ? GMemAllocTagNames[tag] : "Total";
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3272,23 +4129,47 @@ void ImGui::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data
     GImAllocatorUserData = user_data;
 }
 
+// The new context is made current during its initialization so that its allocations are accounted to it.
+// It stays current if there was no current context before.
 ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
+    ImGuiContext* prev_ctx = GImGui;
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    // Capture the allocator functions of the calling thread, the context structure itself is allocated with them too.
+    ImGuiContext* ctx = IM_PLACEMENT_NEW(GImAllocatorAllocFunc(sizeof(ImGuiContext), GImAllocatorUserData)) ImGuiContext(shared_font_atlas);
+    ctx->MemAllocFunc = GImAllocatorAllocFunc;
+    ctx->MemFreeFunc = GImAllocatorFreeFunc;
+    ctx->MemAllocatorUserData = GImAllocatorUserData;
+#else
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
-    if (GImGui == NULL)
-        SetCurrentContext(ctx);
+#endif
+    SetCurrentContext(ctx);
     Initialize(ctx);
+    SetCurrentContext(prev_ctx != NULL ? prev_ctx : ctx);
     return ctx;
 }
 
 void ImGui::DestroyContext(ImGuiContext* ctx)
 {
+    ImGuiContext* prev_ctx = GImGui;
     if (ctx == NULL)
-        ctx = GImGui;
+        ctx = prev_ctx;
+    SetCurrentContext(ctx);
     Shutdown(ctx);
-    if (GImGui == ctx)
-        SetCurrentContext(NULL);
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    // Destruct while current so remaining buffers are released with the context allocator, then release the structure itself.
+    void (*free_func)(void* ptr, void* user_data) = ctx->MemFreeFunc;
+    void* user_data = ctx->MemAllocatorUserData;
+    ctx->~ImGuiContext();
+    SetCurrentContext((prev_ctx != ctx) ? prev_ctx : NULL);
+    if (free_func)
+        free_func(ctx, user_data);
+    else
+        MemFree(ctx);
+#else
+    SetCurrentContext((prev_ctx != ctx) ? prev_ctx : NULL);
     IM_DELETE(ctx);
+#endif
 }
 
 ImGuiIO& ImGui::GetIO()
@@ -3329,6 +4210,22 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+// Detached draw lists may be filled from other threads until the next call to NewFrame(), then appended to a window draw list with AddDrawList().
+// They use a copy of the shared data which isn't modified during the frame (so the simplified AddText() overload uses the default font).
+// Only ImDrawList functions may be called from other threads. They only access the context for allocations: with IMGUI_USE_THREAD_LOCAL_CONTEXT,
+// make the context current in the worker thread so they use its allocator (which must be thread-safe).
+void ImGui::SetupDetachedDrawList(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImDrawList* parent_draw_list = window->DrawList;
+    draw_list->_Data = &g.DrawListSharedDataDetached;
+    draw_list->Clear();
+    draw_list->_OwnerName = window->Name;
+    draw_list->PushTextureID(parent_draw_list->_TextureIdStack.Size ? parent_draw_list->_TextureIdStack.back() : g.IO.Fonts->TexID);
+    draw_list->PushClipRect(parent_draw_list->GetClipRectMin(), parent_draw_list->GetClipRectMax());
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -3354,6 +4251,7 @@ void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 // but if we should more thoroughly test cases where g.ActiveId or g.MovingWindow gets changed and not the other.
 void ImGui::UpdateMouseMovingWindowNewFrame()
 {
+    IMGUI_PROFILER_SCOPE("UpdateMouseMovingWindowNewFrame");
     ImGuiContext& g = *GImGui;
     if (g.MovingWindow != NULL)
     {
@@ -3394,6 +4292,7 @@ void ImGui::UpdateMouseMovingWindowNewFrame()
 // Handle left-click and right-click focus.
 void ImGui::UpdateMouseMovingWindowEndFrame()
 {
+    IMGUI_PROFILER_SCOPE("UpdateMouseMovingWindowEndFrame");
     ImGuiContext& g = *GImGui;
     if (g.ActiveId != 0 || g.HoveredId != 0)
         return;
@@ -3449,6 +4348,7 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
 
 static void ImGui::UpdateMouseInputs()
 {
+    IMGUI_PROFILER_SCOPE("UpdateMouseInputs");
     ImGuiContext& g = *GImGui;
 
     // Round mouse position to avoid spreading non-rounded position (e.g. UpdateManualResize doesn't support them well)
@@ -3516,6 +4416,7 @@ static void StartLockWheelingWindow(ImGuiWindow* window)
 
 void ImGui::UpdateMouseWheel()
 {
+    IMGUI_PROFILER_SCOPE("UpdateMouseWheel");
     ImGuiContext& g = *GImGui;
 
     // Reset the locked window if we move the mouse or after the timer elapses
@@ -3629,6 +4530,7 @@ void ImGui::UpdateTabFocus()
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags()
 {
+    IMGUI_PROFILER_SCOPE("UpdateHoveredWindowAndCaptureFlags");
     ImGuiContext& g = *GImGui;
 
     // Find the window hovered by mouse:
@@ -3704,6 +4606,13 @@ void ImGui::NewFrame()
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     ImGuiTestEngineHook_PreNewFrame(&g);
 #endif
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerNewFrame(&g);
+#endif
+    IMGUI_PROFILER_BEGIN("NewFrame", NULL); // Explicitly ended before creating the implicit window, which stays open until EndFrame()
+
+    // Record inputs, or overwrite them with a recorded frame
+    UpdateInputRecording();
 
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
@@ -3715,6 +4624,18 @@ void ImGui::NewFrame()
     g.WithinFrameScope = true;
     g.FrameCount += 1;
     g.TooltipOverrideCount = 0;
+    g.IO.MetricsFrameAllocations = g.FrameAllocationsCount;
+    g.FrameAllocationsCount = 0;
+    g.FrameArena.Reset();
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    for (int n = 0; n <= ImGuiMemAllocTag_COUNT; n++)
+    {
+        ImGuiMemAllocStats& stats = g.MemAllocStats[n];
+        stats.FrameAllocCount = stats.CurrFrameAllocCount;
+        stats.FrameAllocBytes = stats.CurrFrameAllocBytes;
+        stats.CurrFrameAllocCount = stats.CurrFrameAllocBytes = 0;
+    }
+#endif
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
 
@@ -3725,7 +4646,9 @@ void ImGui::NewFrame()
     g.IO.Framerate = (g.FramerateSecPerFrameAccum > 0.0f) ? (1.0f / (g.FramerateSecPerFrameAccum / (float)IM_ARRAYSIZE(g.FramerateSecPerFrame))) : FLT_MAX;
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // (an atlas locked for sharing is permanently locked and must not be written to, as other threads may be reading it)
+    if (!g.IO.Fonts->LockedForSharing)
+        g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
@@ -3734,10 +4657,15 @@ void ImGui::NewFrame()
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
+    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
+    if (g.Style.RoundCornersUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_RoundCornersUseTex;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    g.DrawListSharedDataDetached = g.DrawListSharedData;
 
     g.BackgroundDrawList.Clear();
     g.BackgroundDrawList.PushTextureID(g.IO.Fonts->TexID);
@@ -3833,6 +4761,7 @@ void ImGui::NewFrame()
     UpdateTabFocus();
 
     // Mark all windows as not visible and compact unused memory.
+    IMGUI_PROFILER_BEGIN("UpdateWindows", NULL);
     IM_ASSERT(g.WindowsFocusOrder.Size == g.Windows.Size);
     const float memory_compact_start_time = (g.IO.ConfigWindowsMemoryCompactTimer >= 0.0f) ? (float)g.Time - g.IO.ConfigWindowsMemoryCompactTimer : FLT_MAX;
     for (int i = 0; i != g.Windows.Size; i++)
@@ -3846,7 +4775,14 @@ void ImGui::NewFrame()
         // Garbage collect transient buffers of recently unused windows
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
+
+        // Garbage collect state storage entries unused for a while (opt-in, on the same timer, disabled along with it)
+        if (g.IO.ConfigWindowsStorageGcFrames > 0 && g.IO.ConfigWindowsMemoryCompactTimer >= 0.0f && window->StateStorageUsage.GetSize() > 0 && window->StateStorageGcTime < memory_compact_start_time)
+            GcCompactStateStorage(window);
     }
+    if (g.IO.ConfigMemoryBudget > 0)
+        GcEnforceMemoryBudget();
+    IMGUI_PROFILER_END();
 
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
@@ -3861,6 +4797,8 @@ void ImGui::NewFrame()
     // [DEBUG] Item picker tool - start with DebugStartItemPicker() - useful to visually select an item and break into its call-stack.
     UpdateDebugToolItemPicker();
 
+    IMGUI_PROFILER_END(); // NewFrame
+
     // Create implicit/fallback window - which we will only render it if the user has added something to it.
     // We don't use "Debug" to avoid colliding with user trying to create a "Debug" window with custom flags.
     // This fallback is particularly important as it avoid ImGui:: calls from crashing.
@@ -3903,6 +4841,13 @@ void ImGui::Initialize(ImGuiContext* context)
 {
     ImGuiContext& g = *context;
     IM_ASSERT(!g.Initialized && !g.SettingsLoaded);
+    g.WindowsAllocator.Init(sizeof(ImGuiWindow), 16);
+
+    // Create the font atlas if not shared, otherwise hold a reference to the shared atlas
+    if (g.FontAtlasOwnedByContext)
+        g.IO.Fonts = IM_NEW(ImFontAtlas)();
+    else
+        ImAtomicAdd(&g.IO.Fonts->RefCount, +1);
 
     // Add .ini handle for ImGuiWindow type
     {
@@ -3944,6 +4889,10 @@ void ImGui::Shutdown(ImGuiContext* context)
         g.IO.Fonts->Locked = false;
         IM_DELETE(g.IO.Fonts);
     }
+    else if (g.IO.Fonts && g.Initialized)
+    {
+        ImAtomicAdd(&g.IO.Fonts->RefCount, -1);
+    }
     g.IO.Fonts = NULL;
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
@@ -3961,7 +4910,11 @@ void ImGui::Shutdown(ImGuiContext* context)
 
     // Clear everything else
     for (int i = 0; i < g.Windows.Size; i++)
-        IM_DELETE(g.Windows[i]);
+    {
+        g.Windows[i]->~ImGuiWindow();
+        g.WindowsAllocator.Free(g.Windows[i]);
+    }
+    g.WindowsAllocator.Clear();
     g.Windows.clear();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
@@ -3990,6 +4943,7 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.InputTextState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -4001,6 +4955,17 @@ void ImGui::Shutdown(ImGuiContext* context)
         g.LogFile = NULL;
     }
     g.LogBuffer.clear();
+    g.FrameArena.Clear();
+    g.InputRecorder.Recording = g.InputRecorder.Replaying = false;
+    g.InputRecorder.Data.clear();
+
+#ifdef IMGUI_ENABLE_PROFILER
+    for (int n = 0; n < g.Profiler.Frames.Size; n++)
+        IM_DELETE(g.Profiler.Frames[n]);
+    g.Profiler.Frames.clear();
+    g.Profiler.Stack.clear();
+    g.Profiler.TraceData.clear();
+#endif
 
     g.Initialized = false;
 }
@@ -4115,8 +5080,58 @@ void ImDrawDataBuilder::FlattenIntoSingleLayer()
     }
 }
 
+// Fast non-cryptographic hash over 8-byte words, only used to detect changes in the draw data
+static ImU64 HashDrawDataBuffer(const void* data, size_t data_size, ImU64 seed)
+{
+    const ImU64 k = ((ImU64)0x9E3779B9 << 32) | 0x7F4A7C15;
+    ImU64 h = seed ^ (ImU64)data_size;
+    const unsigned char* p = (const unsigned char*)data;
+    for (; data_size >= 8; p += 8, data_size -= 8)
+    {
+        ImU64 w;
+        memcpy(&w, p, 8);
+        h = (h ^ w) * k;
+        h ^= h >> 29;
+    }
+    if (data_size > 0)
+    {
+        ImU64 w = 0;
+        memcpy(&w, p, data_size);
+        h = (h ^ w) * k;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+static ImU64 HashDrawData(const ImDrawData* draw_data)
+{
+    IMGUI_PROFILER_SCOPE("HashDrawData");
+    ImU64 h = HashDrawDataBuffer(&draw_data->DisplayPos, sizeof(ImVec2), (ImU64)draw_data->CmdListsCount);
+    h = HashDrawDataBuffer(&draw_data->DisplaySize, sizeof(ImVec2), h);
+    h = HashDrawDataBuffer(&draw_data->FramebufferScale, sizeof(ImVec2), h);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        h = HashDrawDataBuffer(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), h);
+        h = HashDrawDataBuffer(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), h);
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            // Hash fields individually as ImDrawCmd may contain padding
+            const ImDrawCmd& cmd = draw_list->CmdBuffer.Data[cmd_n];
+            h = HashDrawDataBuffer(&cmd.ClipRect, sizeof(cmd.ClipRect), h);
+            h = HashDrawDataBuffer(&cmd.TextureId, sizeof(cmd.TextureId), h);
+            h = HashDrawDataBuffer(&cmd.UserCallback, sizeof(cmd.UserCallback), h);
+            h = HashDrawDataBuffer(&cmd.UserCallbackData, sizeof(cmd.UserCallbackData), h);
+            const unsigned int counts[3] = { cmd.ElemCount, cmd.VtxOffset, cmd.IdxOffset };
+            h = HashDrawDataBuffer(counts, sizeof(counts), h);
+        }
+    }
+    return h;
+}
+
 static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_data)
 {
+    IMGUI_PROFILER_SCOPE("SetupDrawData");
     ImGuiIO& io = ImGui::GetIO();
     draw_data->Valid = true;
     draw_data->CmdLists = (draw_lists->Size > 0) ? draw_lists->Data : NULL;
@@ -4130,6 +5145,12 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
         draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
         draw_data->TotalIdxCount += draw_lists->Data[n]->IdxBuffer.Size;
     }
+
+    // Compare with previous frame
+    ImGuiContext& g = *GImGui;
+    draw_data->ContentHash = io.ConfigDrawDataHash ? HashDrawData(draw_data) : 0;
+    draw_data->ContentUnchanged = io.ConfigDrawDataHash && draw_data->ContentHash == g.DrawDataPrevContentHash;
+    g.DrawDataPrevContentHash = draw_data->ContentHash;
 }
 
 // When using this function it is sane to ensure that float are perfectly rounded to integer values, to that e.g. (int)(max.x-min.x) in user's render produce correct result.
@@ -4147,6 +5168,62 @@ void ImGui::PopClipRect()
     window->ClipRect = window->DrawList->_ClipRectStack.back();
 }
 
+// Compute io.NextFrameDelay: how long the application may wait for inputs before we need a new frame (only knows about our own timers and animations).
+static void ImGui::UpdateNextFrameDelay()
+{
+    IMGUI_PROFILER_SCOPE("UpdateNextFrameDelay");
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+
+    // Ongoing interactions, fades and navigation requests
+    bool want_frame_now = (g.FrameCount < 3) || (g.MovingWindow != NULL) || g.DragDropActive || io.WantSetMousePos;
+    want_frame_now |= (g.NavWindowingTargetAnim != NULL) || (g.DimBgRatio > 0.0f && g.DimBgRatio < 1.0f);
+    want_frame_now |= g.NavAnyRequest || g.NavInitRequest || (g.NavMoveRequestForward != ImGuiNavForward_None) || (g.FocusRequestNextWindow != NULL);
+    want_frame_now |= (g.ActiveId != 0 && g.ActiveId != g.InputTextState.ID);
+    want_frame_now |= (g.HoveredId != 0 && g.HoveredIdTimer < HOVERED_ID_VISUAL_DELAY_MAX);
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown) && !want_frame_now; n++)
+        want_frame_now |= io.MouseDown[n];
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown) && !want_frame_now; n++)
+        want_frame_now |= io.KeysDown[n];
+    for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs) && !want_frame_now; n++)
+        want_frame_now |= (io.NavInputs[n] > 0.0f);
+    for (int n = 0; n < g.OpenPopupStack.Size && !want_frame_now; n++)
+        want_frame_now |= (g.OpenPopupStack[n].Window == NULL);
+
+    // Windows still auto-fitting, hidden for one frame or with a pending scroll request
+    for (int n = 0; n < g.Windows.Size && !want_frame_now; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (!window->Active)
+            continue;
+        want_frame_now |= (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0);
+        want_frame_now |= (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX);
+    }
+    if (want_frame_now)
+    {
+        io.NextFrameDelay = 0.0f;
+        return;
+    }
+
+    // Timers
+    float delay = FLT_MAX;
+    if (g.ActiveId != 0 && g.ActiveId == g.InputTextState.ID && io.ConfigInputTextCursorBlink)
+    {
+        // Same blinking period as InputTextEx(): visible for 0.80f, hidden for 0.40f
+        const float cursor_anim = g.InputTextState.CursorAnim;
+        if (cursor_anim < 0.0f)
+            delay = -cursor_anim + 0.80f;
+        else
+        {
+            const float phase = ImFmod(cursor_anim, 1.20f);
+            delay = (phase <= 0.80f ? 0.80f : 1.20f) - phase;
+        }
+    }
+    if (g.SettingsDirtyTimer > 0.0f)
+        delay = ImMin(delay, g.SettingsDirtyTimer);
+    io.NextFrameDelay = ImMax(delay, 0.0f);
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -4174,6 +5251,8 @@ void ImGui::EndFrame()
         g.CurrentWindow->Active = false;
     End();
 
+    IMGUI_PROFILER_SCOPE("EndFrame"); // After ending the implicit window, whose scope started in NewFrame()
+
     // Show CTRL+TAB list window
     if (g.NavWindowingTarget != NULL)
         NavUpdateWindowingOverlay();
@@ -4204,6 +5283,7 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because childs may not exist yet
+    IMGUI_PROFILER_BEGIN("SortWindows", NULL);
     g.WindowsTempSortBuffer.resize(0);
     g.WindowsTempSortBuffer.reserve(g.Windows.Size);
     for (int i = 0; i != g.Windows.Size; i++)
@@ -4218,9 +5298,14 @@ void ImGui::EndFrame()
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
+    IMGUI_PROFILER_END();
+
+    // Tell the application when we need another frame if it is waiting for inputs
+    UpdateNextFrameDelay();
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (!g.IO.Fonts->LockedForSharing)
+        g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
@@ -4235,6 +5320,8 @@ void ImGui::Render()
 
     if (g.FrameCountEnded != g.FrameCount)
         EndFrame();
+    IMGUI_PROFILER_SCOPE("Render");
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_DrawLists);
     g.FrameCountRendered = g.FrameCount;
     g.IO.MetricsRenderWindows = 0;
     g.DrawDataBuilder.Clear();
@@ -4244,6 +5331,7 @@ void ImGui::Render()
         AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.BackgroundDrawList);
 
     // Add ImDrawList to render
+    IMGUI_PROFILER_BEGIN("AddWindowsToDrawData", NULL);
     ImGuiWindow* windows_to_render_top_most[2];
     windows_to_render_top_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
     windows_to_render_top_most[1] = (g.NavWindowingTarget ? g.NavWindowingList : NULL);
@@ -4257,6 +5345,7 @@ void ImGui::Render()
         if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
             AddRootWindowToDrawData(windows_to_render_top_most[n]);
     g.DrawDataBuilder.FlattenIntoSingleLayer();
+    IMGUI_PROFILER_END();
 
     // Draw software mouse cursor if requested
     if (g.IO.MouseDrawCursor)
@@ -4306,6 +5395,8 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 // called, aka before the next Begin(). Moving window isn't affected.
+// FIXME-OPT: Linear scan, but it runs once per frame and costs well under 1 ns per window. A grid over the window rectangles
+// rebuilt in EndFrame() was measured slower overall with 1000 windows: maintaining it costs more than the scan it saves.
 static void FindHoveredWindow()
 {
     ImGuiContext& g = *GImGui;
@@ -4845,11 +5936,12 @@ ImGuiWindow* ImGui::FindWindowByName(const char* name)
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImVec2 size, ImGuiWindowFlags flags)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Windows);
     ImGuiContext& g = *GImGui;
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
     // Create window the first time
-    ImGuiWindow* window = IM_NEW(ImGuiWindow)(&g, name);
+    ImGuiWindow* window = IM_PLACEMENT_NEW(g.WindowsAllocator.Alloc()) ImGuiWindow(&g, name);
     window->Flags = flags;
     g.WindowsById.SetVoidPtr(window->ID, window);
 
@@ -5396,6 +6488,136 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
     }
 }
 
+// Clip rectangles equal to the host clipping rectangle follow the host, the others follow the window.
+static inline ImVec4 TranslateCachedClipRect(const ImVec4& clip_rect, const ImVec4& cached_host_clip_rect, const ImVec4& host_clip_rect, const ImVec2& delta)
+{
+    if (memcmp(&clip_rect, &cached_host_clip_rect, sizeof(ImVec4)) == 0)
+        return host_clip_rect;
+    return ImVec4(clip_rect.x + delta.x, clip_rect.y + delta.y, clip_rect.z + delta.x, clip_rect.w + delta.y);
+}
+
+// Hovered, focused or active windows may display interaction feedback: their output can't be reused nor recorded.
+static bool IsWindowDrawCacheInteracting(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.HoveredWindow == window || g.MovingWindow == window || g.NavWindow == window || g.ActiveIdWindow == window || g.ActiveIdPreviousFrameWindow == window)
+        return true;
+    for (int n = 0; n < g.OpenPopupStack.Size; n++)
+    {
+        const ImGuiPopupData& popup_data = g.OpenPopupStack[n];
+        if (popup_data.SourceWindow == window || popup_data.Window == NULL || popup_data.Window->ParentWindow == window)
+            return true;
+    }
+    return false;
+}
+
+// Called at the end of Begin() when the window submitted the same content hash as the cached draw list.
+// Nothing that can alter the content output must have changed: no interaction with the window, same size/scroll/font,
+// and what Begin() has just drawn (background, title bar, scrollbars, resize grips...) must match the cached version.
+static bool IsWindowDrawCacheReusable(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiWindowDrawCache& cache = window->DrawCache;
+    const ImDrawList* draw_list = window->DrawList;
+    if (cache.CachedContentHash != cache.ContentHash || window->Appearing || window->Hidden || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0)
+        return false;
+    if (cache.Size.x != window->Size.x || cache.Size.y != window->Size.y || cache.Scroll.x != window->Scroll.x || cache.Scroll.y != window->Scroll.y)
+        return false;
+    if (cache.Font != g.Font || cache.FontSize != g.FontSize || draw_list != &window->DrawListInst)
+        return false;
+
+    if (IsWindowDrawCacheInteracting(window))
+        return false;
+
+    // Clip rectangles may only be translated if none of them was clamped by the host rectangle
+    const ImVec2 delta = window->Pos - cache.Pos;
+    const ImVec4 host_clip_rect = draw_list->_ClipRectStack[0];
+    const bool host_unchanged = memcmp(&host_clip_rect, &cache.HostClipRect, sizeof(ImVec4)) == 0;
+    if (!(delta.x == 0.0f && delta.y == 0.0f && host_unchanged) && !(cache.HostContained && ImRect(host_clip_rect).Contains(window->Rect())))
+        return false;
+
+    // Compare decorations
+    if (cache.BeginCmdCount != cache.DecoCmdCount || cache.BeginIdxCount != cache.DecoIdxCount || cache.BeginVtxCount != cache.DecoVtxCount)
+        return false;
+    if (memcmp(draw_list->IdxBuffer.Data, cache.IdxBuffer.Data, (size_t)cache.DecoIdxCount * sizeof(ImDrawIdx)) != 0)
+        return false;
+    for (int n = 0; n < cache.DecoVtxCount; n++)
+    {
+        const ImDrawVert& v = draw_list->VtxBuffer.Data[n];
+        const ImDrawVert& cached_v = cache.VtxBuffer.Data[n];
+        if (v.pos.x != cached_v.pos.x + delta.x || v.pos.y != cached_v.pos.y + delta.y || v.uv.x != cached_v.uv.x || v.uv.y != cached_v.uv.y || v.col != cached_v.col)
+            return false;
+    }
+    for (int n = 0; n < cache.DecoCmdCount; n++)
+    {
+        // The last command is still open: its ElemCount is covered by the index count test above
+        const ImDrawCmd& cmd = draw_list->CmdBuffer.Data[n];
+        const ImDrawCmd& cached_cmd = cache.CmdBuffer.Data[n];
+        const ImVec4 cached_clip_rect = TranslateCachedClipRect(cached_cmd.ClipRect, cache.HostClipRect, host_clip_rect, delta);
+        if ((n + 1 < cache.DecoCmdCount && cmd.ElemCount != cached_cmd.ElemCount) || cmd.TextureId != cached_cmd.TextureId || cmd.VtxOffset != cached_cmd.VtxOffset || cmd.IdxOffset != cached_cmd.IdxOffset)
+            return false;
+        if (cmd.UserCallback != NULL || memcmp(&cmd.ClipRect, &cached_clip_rect, sizeof(ImVec4)) != 0)
+            return false;
+    }
+    return true;
+}
+
+// Called by End() for windows with a content hash: restore the cached draw list when Begin() decided to reuse it, otherwise record it.
+static void UpdateWindowDrawCache(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowDrawCache& cache = window->DrawCache;
+    ImDrawList* draw_list = window->DrawList;
+    if (cache.Replaying)
+    {
+        const ImVec2 delta = window->Pos - cache.Pos;
+        const ImVec4 host_clip_rect = draw_list->_ClipRectStack[0];
+        draw_list->CmdBuffer.resize(cache.CmdBuffer.Size);
+        draw_list->IdxBuffer.resize(cache.IdxBuffer.Size);
+        draw_list->VtxBuffer.resize(cache.VtxBuffer.Size);
+        memcpy(draw_list->CmdBuffer.Data, cache.CmdBuffer.Data, (size_t)cache.CmdBuffer.size_in_bytes());
+        memcpy(draw_list->IdxBuffer.Data, cache.IdxBuffer.Data, (size_t)cache.IdxBuffer.size_in_bytes());
+        memcpy(draw_list->VtxBuffer.Data, cache.VtxBuffer.Data, (size_t)cache.VtxBuffer.size_in_bytes());
+        if (delta.x != 0.0f || delta.y != 0.0f)
+            for (ImDrawVert* vtx = draw_list->VtxBuffer.Data, *vtx_end = vtx + draw_list->VtxBuffer.Size; vtx < vtx_end; vtx++)
+                vtx->pos += delta;
+        for (int n = 0; n < draw_list->CmdBuffer.Size; n++)
+            draw_list->CmdBuffer[n].ClipRect = TranslateCachedClipRect(draw_list->CmdBuffer[n].ClipRect, cache.HostClipRect, host_clip_rect, delta);
+        draw_list->_VtxCurrentIdx = cache.VtxCurrentIdx;
+        draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size;
+        draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+        return;
+    }
+
+    // Only record content which has been stable for a few frames and doesn't display interaction feedback, so windows
+    // whose content changes every frame don't pay for a copy of their draw list that will never be reused.
+    // Child windows and popups are submitted from within the content, they would disappear if we skipped it.
+    cache.CachedContentHash = 0;
+    if (cache.StableFrames < WINDOWS_DRAW_CACHE_STABLE_FRAMES || IsWindowDrawCacheInteracting(window))
+        return;
+    if (window->SkipItems || window->DC.ChildWindows.Size > 0 || draw_list != &window->DrawListInst || draw_list->_Splitter._Count > 1)
+        return;
+    cache.CachedContentHash = cache.ContentHash;
+    cache.Pos = window->Pos;
+    cache.Size = window->Size;
+    cache.Scroll = window->Scroll;
+    cache.ContentSizeRaw = window->DC.CursorMaxPos - window->DC.CursorStartPos;
+    cache.HostClipRect = draw_list->_ClipRectStack[0];
+    cache.HostContained = ImRect(cache.HostClipRect).Contains(window->Rect());
+    cache.Font = g.Font;
+    cache.FontSize = g.FontSize;
+    cache.DecoCmdCount = cache.BeginCmdCount;
+    cache.DecoIdxCount = cache.BeginIdxCount;
+    cache.DecoVtxCount = cache.BeginVtxCount;
+    cache.VtxCurrentIdx = draw_list->_VtxCurrentIdx;
+    cache.CmdBuffer.resize(draw_list->CmdBuffer.Size);
+    cache.IdxBuffer.resize(draw_list->IdxBuffer.Size);
+    cache.VtxBuffer.resize(draw_list->VtxBuffer.Size);
+    memcpy(cache.CmdBuffer.Data, draw_list->CmdBuffer.Data, (size_t)draw_list->CmdBuffer.size_in_bytes());
+    memcpy(cache.IdxBuffer.Data, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+    memcpy(cache.VtxBuffer.Data, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+}
+
 // Push a new Dear ImGui window to add widgets to.
 // - A default window called "Debug" is automatically stacked at the beginning of every frame so you can use widgets without explicitly calling a Begin/End pair.
 // - Begin/End can be called multiple times during the frame with the same window name to append content.
@@ -5410,6 +6632,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    IMGUI_PROFILER_BEGIN("Begin", name);            // Ended by End()
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Windows);
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -5516,6 +6740,15 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->ContentSizeExplicit = g.NextWindowData.ContentSizeVal;
     else if (first_begin_of_the_frame)
         window->ContentSizeExplicit = ImVec2(0.0f, 0.0f);
+    if (first_begin_of_the_frame)
+    {
+        ImGuiWindowDrawCache& cache = window->DrawCache;
+        const ImGuiID content_hash = (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasContentHash) ? g.NextWindowData.ContentHashVal : 0;
+        cache.StableFrames = (content_hash != 0 && content_hash == cache.ContentHash && cache.LastFrameActive + 1 == g.FrameCount) ? cache.StableFrames + 1 : 0;
+        cache.ContentHash = content_hash;
+        cache.LastFrameActive = g.FrameCount;
+        cache.Replaying = false;
+    }
     if (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasCollapsed)
         SetWindowCollapsed(window, g.NextWindowData.CollapsedVal, g.NextWindowData.CollapsedCond);
     if (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasFocus)
@@ -5973,6 +7206,14 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
     PushClipRect(window->InnerClipRect.Min, window->InnerClipRect.Max, true);
 
+    // Remember what Begin() has drawn, to compare it with the cached draw list
+    if (first_begin_of_the_frame && window->DrawCache.ContentHash != 0)
+    {
+        window->DrawCache.BeginCmdCount = window->DrawList->CmdBuffer.Size;
+        window->DrawCache.BeginIdxCount = window->DrawList->IdxBuffer.Size;
+        window->DrawCache.BeginVtxCount = window->DrawList->VtxBuffer.Size;
+    }
+
     // Clear 'accessed' flag last thing (After PushClipRect which will set the flag. We want the flag to stay false when the default "Debug" window is unused)
     if (first_begin_of_the_frame)
         window->WriteAccessed = false;
@@ -6008,6 +7249,15 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (window->Collapsed || !window->Active || window->Hidden)
         if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
             skip_items = true;
+
+    // Reuse last frame draw list if the content hash didn't change: items are skipped and End() will restore the draw list
+    if (first_begin_of_the_frame && !skip_items && window->DrawCache.ContentHash != 0 && IsWindowDrawCacheReusable(window))
+    {
+        window->DrawCache.Replaying = true;
+        window->DC.CursorMaxPos = window->DC.CursorStartPos + window->DrawCache.ContentSizeRaw;
+        window->DC.NavLayerActiveMaskNext = window->DC.NavLayerActiveMask;
+        skip_items = true;
+    }
     window->SkipItems = skip_items;
 
     return !skip_items;
@@ -6035,6 +7285,10 @@ void ImGui::End()
         EndColumns();
     PopClipRect();   // Inner window clip rectangle
 
+    // Record or restore the draw list (only for the first Begin/End pair of the frame)
+    if (window->DrawCache.ContentHash != 0 && window->BeginCount == 1)
+        UpdateWindowDrawCache(window);
+
     // Stop logging
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
         LogFinish();
@@ -6045,6 +7299,7 @@ void ImGui::End()
         g.BeginPopupStack.pop_back();
     ErrorCheckBeginEndCompareStacksSize(window, false);
     SetCurrentWindow(g.CurrentWindowStack.empty() ? NULL : g.CurrentWindowStack.back());
+    IMGUI_PROFILER_END(); // Begin
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -6168,6 +7423,9 @@ void ImGui::SetCurrentFont(ImFont* font)
 
     ImFontAtlas* atlas = g.Font->ContainerAtlas;
     g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel;
+    g.DrawListSharedData.TexUvLines = (atlas->Flags & ImFontAtlasFlags_NoBakedLines) ? NULL : atlas->TexUvLines;
+    g.DrawListSharedData.TexUvRoundCornersFill = (atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners) ? NULL : atlas->TexUvRoundCornersFill;
+    g.DrawListSharedData.TexUvRoundCornersStroke = (atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners) ? NULL : atlas->TexUvRoundCornersStroke;
     g.DrawListSharedData.Font = g.Font;
     g.DrawListSharedData.FontSize = g.FontSize;
 }
@@ -6535,6 +7793,13 @@ void ImGui::SetNextWindowBgAlpha(float alpha)
     g.NextWindowData.BgAlphaVal = alpha;
 }
 
+void ImGui::SetNextWindowContentHash(ImGuiID content_hash)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextWindowData.Flags |= ImGuiNextWindowDataFlags_HasContentHash;
+    g.NextWindowData.ContentHashVal = content_hash;
+}
+
 ImDrawList* ImGui::GetWindowDrawList()
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -6715,6 +7980,16 @@ bool ImGui::DebugCheckVersionAndDataLayout(const char* version, size_t sz_io, si
     return !error;
 }
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+// Positions are clamped to the range of the compact vertex layout, which bends slanted primitives crossing it (see imconfig.h).
+// Atomic as ImDrawList may be built from other threads (see SetupDetachedDrawList()).
+void ImGui::DebugNotifyDrawVertSaturated()
+{
+    if (ImGuiContext* ctx = GImGui)
+        ImAtomicAdd(&ctx->DebugDrawVertSaturatedCount, +1);
+}
+#endif
+
 static void ImGui::ErrorCheckNewFrameSanityChecks()
 {
     ImGuiContext& g = *GImGui;
@@ -7044,6 +8319,15 @@ void ImGui::SetNextItemWidth(float item_width)
     g.NextItemData.Width = item_width;
 }
 
+// The pointer comparison in GetItemLabelID() makes a stale literal harmless: a label at the same address has the same hash.
+const char* ImGui::SetNextItemLabelLiteral(const ImGuiIDLiteral& label)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextItemData.Flags |= ImGuiNextItemDataFlags_HasLabelLiteral;
+    g.NextItemData.LabelLiteral = label;
+    return label.Str;
+}
+
 void ImGui::PushItemWidth(float item_width)
 {
     ImGuiContext& g = *GImGui;
@@ -8387,6 +9671,7 @@ ImVec2 ImGui::GetNavInputAmount2d(ImGuiNavDirSourceFlags dir_sources, ImGuiInput
 
 static void ImGui::NavUpdate()
 {
+    IMGUI_PROFILER_SCOPE("NavUpdate");
     ImGuiContext& g = *GImGui;
     g.IO.WantSetMousePos = false;
 #if 0
@@ -9538,6 +10823,8 @@ void ImGui::LogButtons()
 // Called by NewFrame()
 void ImGui::UpdateSettings()
 {
+    IMGUI_PROFILER_SCOPE("UpdateSettings");
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Settings);
     // Load settings on first frame (if not explicitly loaded manually before)
     ImGuiContext& g = *GImGui;
     if (!g.SettingsLoaded)
@@ -9580,6 +10867,7 @@ void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
 
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Settings);
     ImGuiContext& g = *GImGui;
 
 #if !IMGUI_DEBUG_INI_SETTINGS
@@ -9597,16 +10885,19 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
 
+    // Index by ID. Offsets stay valid as the stream only grows from the back. In case of duplicate ID we keep pointing to the first entry, like a linear search would.
+    int* p_offset = g.SettingsWindowsMap.GetIntRef(settings->ID, -1);
+    if (*p_offset == -1)
+        *p_offset = g.SettingsWindows.offset_from_ptr(settings);
+
     return settings;
 }
 
 ImGuiWindowSettings* ImGui::FindWindowSettings(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsWindowsMap.GetInt(id, -1);
+    return (offset != -1) ? g.SettingsWindows.ptr_from_offset(offset) : NULL;
 }
 
 ImGuiWindowSettings* ImGui::FindOrCreateWindowSettings(const char* name)
@@ -9639,6 +10930,7 @@ ImGuiSettingsHandler* ImGui::FindSettingsHandler(const char* type_name)
 // Zero-tolerance, no error reporting, cheap .ini parsing
 void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Settings);
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
     IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
@@ -9711,6 +11003,7 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Settings);
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
@@ -9780,6 +11073,622 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
 }
 
 
+//-----------------------------------------------------------------------------
+// [SECTION] INPUT RECORDING
+//-----------------------------------------------------------------------------
+// - StartInputRecording(): UpdateInputRecording() appends the inputs read by each NewFrame() to g.InputRecorder.Data.
+// - LoadInputRecordingFromMemory(): UpdateInputRecording() overwrites io inputs with the next recorded frame.
+// - Data layout: header (magic, version, frames count, array sizes, io.ConfigFlags, io.KeyMap[]) then one record
+//   per frame: a 16-bit mask of the fields which changed since the previous frame, followed by their values.
+//   Keys are stored as the list of toggled io.KeysDown[] indices, characters are stored every frame.
+//-----------------------------------------------------------------------------
+
+enum ImGuiInputRecordField_
+{
+    ImGuiInputRecordField_DisplaySize   = 1 << 0,
+    ImGuiInputRecordField_DeltaTime     = 1 << 1,
+    ImGuiInputRecordField_MousePos      = 1 << 2,
+    ImGuiInputRecordField_MouseDown     = 1 << 3,
+    ImGuiInputRecordField_MouseWheel    = 1 << 4,
+    ImGuiInputRecordField_KeyMods       = 1 << 5,
+    ImGuiInputRecordField_KeysDown      = 1 << 6,
+    ImGuiInputRecordField_Characters    = 1 << 7,
+    ImGuiInputRecordField_NavInputs     = 1 << 8
+};
+
+static const ImU32 IMGUI_INPUT_RECORD_MAGIC = 0x52494D49;    // "IMIR"
+static const ImU32 IMGUI_INPUT_RECORD_VERSION = 1;
+static const int   IMGUI_INPUT_RECORD_FRAMES_COUNT_OFFSET = 8;
+
+static void InputRecordWrite(ImVector<char>* buf, const void* data, size_t size)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)size);
+    memcpy(buf->Data + offset, data, size);
+}
+static void InputRecordWriteU8(ImVector<char>* buf, ImU8 v)    { InputRecordWrite(buf, &v, sizeof(v)); }
+static void InputRecordWriteU16(ImVector<char>* buf, ImU16 v)  { InputRecordWrite(buf, &v, sizeof(v)); }
+static void InputRecordWriteU32(ImVector<char>* buf, ImU32 v)  { InputRecordWrite(buf, &v, sizeof(v)); }
+static void InputRecordWriteFloat(ImVector<char>* buf, float v){ InputRecordWrite(buf, &v, sizeof(v)); }
+
+// Bounds-checked reader. Reading past the end sets Error and returns zeroes.
+struct ImGuiInputRecordReader
+{
+    const char* Pos;
+    const char* End;
+    bool        Error;
+
+    ImGuiInputRecordReader(const char* data, const char* data_end) { Pos = data; End = data_end; Error = false; }
+    void        Read(void* out, size_t size)    { if (Error || (size_t)(End - Pos) < size) { Error = true; memset(out, 0, size); return; } memcpy(out, Pos, size); Pos += size; }
+    ImU8        ReadU8()                        { ImU8 v; Read(&v, sizeof(v)); return v; }
+    ImU16       ReadU16()                       { ImU16 v; Read(&v, sizeof(v)); return v; }
+    ImU32       ReadU32()                       { ImU32 v; Read(&v, sizeof(v)); return v; }
+    float       ReadFloat()                     { float v; Read(&v, sizeof(v)); return v; }
+};
+
+static ImU8 InputRecordPackBools(const bool* values, int count)
+{
+    ImU8 bits = 0;
+    for (int n = 0; n < count; n++)
+        if (values[n])
+            bits |= (ImU8)(1 << n);
+    return bits;
+}
+
+static void InputRecordUnpackBools(ImU8 bits, bool* values, int count)
+{
+    for (int n = 0; n < count; n++)
+        values[n] = (bits & (1 << n)) != 0;
+}
+
+static void InputRecordEncodeFrame(ImVector<char>* buf, ImGuiInputRecordState* state, const ImGuiIO& io)
+{
+    const bool key_mods[4] = { io.KeyCtrl, io.KeyShift, io.KeyAlt, io.KeySuper };
+    const bool state_key_mods[4] = { state->KeyCtrl, state->KeyShift, state->KeyAlt, state->KeySuper };
+    int keys_changed = 0, nav_inputs_changed = 0;
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+        keys_changed += (io.KeysDown[n] != state->KeysDown[n]) ? 1 : 0;
+    for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs); n++)
+        nav_inputs_changed += (io.NavInputs[n] != state->NavInputs[n]) ? 1 : 0;
+
+    ImU16 mask = 0;
+    if (io.DisplaySize.x != state->DisplaySize.x || io.DisplaySize.y != state->DisplaySize.y)   mask |= ImGuiInputRecordField_DisplaySize;
+    if (io.DeltaTime != state->DeltaTime)                                                       mask |= ImGuiInputRecordField_DeltaTime;
+    if (io.MousePos.x != state->MousePos.x || io.MousePos.y != state->MousePos.y)               mask |= ImGuiInputRecordField_MousePos;
+    if (memcmp(io.MouseDown, state->MouseDown, sizeof(io.MouseDown)) != 0)                      mask |= ImGuiInputRecordField_MouseDown;
+    if (io.MouseWheel != state->MouseWheel || io.MouseWheelH != state->MouseWheelH)             mask |= ImGuiInputRecordField_MouseWheel;
+    if (memcmp(key_mods, state_key_mods, sizeof(key_mods)) != 0)                                mask |= ImGuiInputRecordField_KeyMods;
+    if (keys_changed > 0)                                                                       mask |= ImGuiInputRecordField_KeysDown;
+    if (io.InputQueueCharacters.Size > 0)                                                       mask |= ImGuiInputRecordField_Characters;
+    if (nav_inputs_changed > 0)                                                                 mask |= ImGuiInputRecordField_NavInputs;
+
+    InputRecordWriteU16(buf, mask);
+    if (mask & ImGuiInputRecordField_DisplaySize)
+    {
+        InputRecordWriteFloat(buf, io.DisplaySize.x);
+        InputRecordWriteFloat(buf, io.DisplaySize.y);
+    }
+    if (mask & ImGuiInputRecordField_DeltaTime)
+        InputRecordWriteFloat(buf, io.DeltaTime);
+    if (mask & ImGuiInputRecordField_MousePos)
+    {
+        InputRecordWriteFloat(buf, io.MousePos.x);
+        InputRecordWriteFloat(buf, io.MousePos.y);
+    }
+    if (mask & ImGuiInputRecordField_MouseDown)
+        InputRecordWriteU8(buf, InputRecordPackBools(io.MouseDown, IM_ARRAYSIZE(io.MouseDown)));
+    if (mask & ImGuiInputRecordField_MouseWheel)
+    {
+        InputRecordWriteFloat(buf, io.MouseWheel);
+        InputRecordWriteFloat(buf, io.MouseWheelH);
+    }
+    if (mask & ImGuiInputRecordField_KeyMods)
+        InputRecordWriteU8(buf, InputRecordPackBools(key_mods, IM_ARRAYSIZE(key_mods)));
+    if (mask & ImGuiInputRecordField_KeysDown)
+    {
+        InputRecordWriteU16(buf, (ImU16)keys_changed);
+        for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+            if (io.KeysDown[n] != state->KeysDown[n])
+                InputRecordWriteU16(buf, (ImU16)n);
+    }
+    if (mask & ImGuiInputRecordField_Characters)
+    {
+        const int count = ImMin(io.InputQueueCharacters.Size, 0xFFFF);
+        InputRecordWriteU16(buf, (ImU16)count);
+        for (int n = 0; n < count; n++)
+            InputRecordWriteU32(buf, (ImU32)io.InputQueueCharacters[n]);
+    }
+    if (mask & ImGuiInputRecordField_NavInputs)
+    {
+        InputRecordWriteU8(buf, (ImU8)nav_inputs_changed);
+        for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs); n++)
+            if (io.NavInputs[n] != state->NavInputs[n])
+            {
+                InputRecordWriteU8(buf, (ImU8)n);
+                InputRecordWriteFloat(buf, io.NavInputs[n]);
+            }
+    }
+
+    state->DisplaySize = io.DisplaySize;
+    state->DeltaTime = io.DeltaTime;
+    state->MousePos = io.MousePos;
+    memcpy(state->MouseDown, io.MouseDown, sizeof(io.MouseDown));
+    state->MouseWheel = io.MouseWheel;
+    state->MouseWheelH = io.MouseWheelH;
+    state->KeyCtrl = io.KeyCtrl;
+    state->KeyShift = io.KeyShift;
+    state->KeyAlt = io.KeyAlt;
+    state->KeySuper = io.KeySuper;
+    memcpy(state->KeysDown, io.KeysDown, sizeof(io.KeysDown));
+    memcpy(state->NavInputs, io.NavInputs, sizeof(io.NavInputs));
+}
+
+// Apply one frame record to 'state'. Characters are written to 'out_characters' if not NULL. Return false on malformed data.
+static bool InputRecordDecodeFrame(ImGuiInputRecordReader* reader, ImGuiInputRecordState* state, ImVector<ImWchar>* out_characters)
+{
+    if (out_characters)
+        out_characters->resize(0);
+    const ImU16 mask = reader->ReadU16();
+    if (mask & ImGuiInputRecordField_DisplaySize)
+    {
+        state->DisplaySize.x = reader->ReadFloat();
+        state->DisplaySize.y = reader->ReadFloat();
+    }
+    if (mask & ImGuiInputRecordField_DeltaTime)
+        state->DeltaTime = reader->ReadFloat();
+    if (mask & ImGuiInputRecordField_MousePos)
+    {
+        state->MousePos.x = reader->ReadFloat();
+        state->MousePos.y = reader->ReadFloat();
+    }
+    if (mask & ImGuiInputRecordField_MouseDown)
+        InputRecordUnpackBools(reader->ReadU8(), state->MouseDown, IM_ARRAYSIZE(state->MouseDown));
+    if (mask & ImGuiInputRecordField_MouseWheel)
+    {
+        state->MouseWheel = reader->ReadFloat();
+        state->MouseWheelH = reader->ReadFloat();
+    }
+    if (mask & ImGuiInputRecordField_KeyMods)
+    {
+        bool key_mods[4];
+        InputRecordUnpackBools(reader->ReadU8(), key_mods, IM_ARRAYSIZE(key_mods));
+        state->KeyCtrl = key_mods[0];
+        state->KeyShift = key_mods[1];
+        state->KeyAlt = key_mods[2];
+        state->KeySuper = key_mods[3];
+    }
+    if (mask & ImGuiInputRecordField_KeysDown)
+    {
+        const int count = reader->ReadU16();
+        for (int n = 0; n < count && !reader->Error; n++)
+        {
+            const int key_index = reader->ReadU16();
+            if (key_index >= IM_ARRAYSIZE(state->KeysDown))
+                return false;
+            state->KeysDown[key_index] = !state->KeysDown[key_index];
+        }
+    }
+    if (mask & ImGuiInputRecordField_Characters)
+    {
+        const int count = reader->ReadU16();
+        for (int n = 0; n < count && !reader->Error; n++)
+        {
+            const ImU32 c = reader->ReadU32();
+            if (out_characters && c > 0 && c <= IM_UNICODE_CODEPOINT_MAX)
+                out_characters->push_back((ImWchar)c);
+        }
+    }
+    if (mask & ImGuiInputRecordField_NavInputs)
+    {
+        const int count = reader->ReadU8();
+        for (int n = 0; n < count && !reader->Error; n++)
+        {
+            const int nav_input = reader->ReadU8();
+            const float value = reader->ReadFloat();
+            if (nav_input >= IM_ARRAYSIZE(state->NavInputs))
+                return false;
+            state->NavInputs[nav_input] = value;
+        }
+    }
+    return !reader->Error;
+}
+
+// Called by NewFrame()
+static void ImGui::UpdateInputRecording()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder& recorder = g.InputRecorder;
+    ImGuiIO& io = g.IO;
+    if (recorder.Recording)
+    {
+        IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Misc);
+        InputRecordEncodeFrame(&recorder.Data, &recorder.State, io);
+        recorder.FramesCount++;
+    }
+    else if (recorder.Replaying)
+    {
+        ImGuiInputRecordReader reader(recorder.Data.Data + recorder.ReplayOffset, recorder.Data.Data + recorder.Data.Size);
+        ImGuiInputRecordState& state = recorder.State;
+        bool ret = InputRecordDecodeFrame(&reader, &state, &io.InputQueueCharacters);
+        IM_ASSERT(ret); // Validated by LoadInputRecordingFromMemory()
+        IM_UNUSED(ret);
+        recorder.ReplayOffset = (int)(reader.Pos - recorder.Data.Data);
+        if (++recorder.ReplayFrame >= recorder.FramesCount)
+            recorder.Replaying = false;
+
+        io.DisplaySize = state.DisplaySize;
+        io.DeltaTime = state.DeltaTime;
+        io.MousePos = state.MousePos;
+        memcpy(io.MouseDown, state.MouseDown, sizeof(io.MouseDown));
+        io.MouseWheel = state.MouseWheel;
+        io.MouseWheelH = state.MouseWheelH;
+        io.KeyCtrl = state.KeyCtrl;
+        io.KeyShift = state.KeyShift;
+        io.KeyAlt = state.KeyAlt;
+        io.KeySuper = state.KeySuper;
+        memcpy(io.KeysDown, state.KeysDown, sizeof(io.KeysDown));
+        memcpy(io.NavInputs, state.NavInputs, sizeof(io.NavInputs));
+    }
+}
+
+void ImGui::StartInputRecording()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder& recorder = g.InputRecorder;
+    recorder.Recording = true;
+    recorder.Replaying = false;
+    recorder.FramesCount = recorder.ReplayFrame = recorder.ReplayOffset = 0;
+    recorder.State = ImGuiInputRecordState();
+    recorder.Data.resize(0);
+
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Misc);
+    InputRecordWriteU32(&recorder.Data, IMGUI_INPUT_RECORD_MAGIC);
+    InputRecordWriteU32(&recorder.Data, IMGUI_INPUT_RECORD_VERSION);
+    IM_ASSERT(recorder.Data.Size == IMGUI_INPUT_RECORD_FRAMES_COUNT_OFFSET);
+    InputRecordWriteU32(&recorder.Data, 0);     // Frames count, written by SaveInputRecordingToMemory()
+    InputRecordWriteU16(&recorder.Data, (ImU16)IM_ARRAYSIZE(g.IO.KeysDown));
+    InputRecordWriteU16(&recorder.Data, (ImU16)IM_ARRAYSIZE(g.IO.NavInputs));
+    InputRecordWriteU16(&recorder.Data, (ImU16)IM_ARRAYSIZE(g.IO.KeyMap));
+    InputRecordWriteU32(&recorder.Data, (ImU32)g.IO.ConfigFlags);
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.KeyMap); n++)
+        InputRecordWriteU32(&recorder.Data, (ImU32)g.IO.KeyMap[n]);
+}
+
+void ImGui::StopInputRecording()
+{
+    ImGuiContext& g = *GImGui;
+    g.InputRecorder.Recording = g.InputRecorder.Replaying = false;
+}
+
+const void* ImGui::SaveInputRecordingToMemory(size_t* out_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder& recorder = g.InputRecorder;
+    if (recorder.Data.Size >= IMGUI_INPUT_RECORD_FRAMES_COUNT_OFFSET + 4)
+    {
+        const ImU32 frames_count = (ImU32)recorder.FramesCount;
+        memcpy(recorder.Data.Data + IMGUI_INPUT_RECORD_FRAMES_COUNT_OFFSET, &frames_count, sizeof(frames_count));
+    }
+    if (out_size)
+        *out_size = (size_t)recorder.Data.Size;
+    return recorder.Data.Data;
+}
+
+bool ImGui::SaveInputRecordingToDisk(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.InputRecorder.FramesCount == 0)
+        return false;
+    size_t data_size = 0;
+    const void* data = SaveInputRecordingToMemory(&data_size);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(data, 1, data_size, f) == (ImU64)data_size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool ImGui::LoadInputRecordingFromMemory(const void* data, size_t data_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder& recorder = g.InputRecorder;
+    ImGuiIO& io = g.IO;
+
+    // Validate the header and every frame before starting to replay
+    ImGuiInputRecordReader reader((const char*)data, (const char*)data + data_size);
+    if (reader.ReadU32() != IMGUI_INPUT_RECORD_MAGIC || reader.ReadU32() != IMGUI_INPUT_RECORD_VERSION)
+        return false;
+    const int frames_count = (int)reader.ReadU32();
+    if (reader.ReadU16() != IM_ARRAYSIZE(io.KeysDown) || reader.ReadU16() != IM_ARRAYSIZE(io.NavInputs) || reader.ReadU16() != IM_ARRAYSIZE(io.KeyMap))
+        return false;
+    const ImGuiConfigFlags config_flags = (ImGuiConfigFlags)reader.ReadU32();
+    int key_map[ImGuiKey_COUNT];
+    for (int n = 0; n < ImGuiKey_COUNT; n++)
+        key_map[n] = (int)reader.ReadU32();
+    if (reader.Error)
+        return false;
+    const int header_size = (int)(reader.Pos - (const char*)data);
+    ImGuiInputRecordState state;
+    for (int n = 0; n < frames_count; n++)
+        if (!InputRecordDecodeFrame(&reader, &state, NULL))
+            return false;
+
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Misc);
+    recorder.Data.resize((int)data_size);
+    memcpy(recorder.Data.Data, data, data_size);
+    recorder.Recording = false;
+    recorder.Replaying = (frames_count > 0);
+    recorder.FramesCount = frames_count;
+    recorder.ReplayFrame = 0;
+    recorder.ReplayOffset = header_size;
+    recorder.State = ImGuiInputRecordState();
+    io.ConfigFlags = config_flags;
+    memcpy(io.KeyMap, key_map, sizeof(io.KeyMap));
+    return true;
+}
+
+bool ImGui::LoadInputRecordingFromDisk(const char* filename)
+{
+    size_t file_data_size = 0;
+    void* file_data = ImFileLoadToMemory(filename, "rb", &file_data_size);
+    if (!file_data)
+        return false;
+    bool ret = LoadInputRecordingFromMemory(file_data, file_data_size);
+    IM_FREE(file_data);
+    return ret;
+}
+
+bool ImGui::IsInputReplaying()
+{
+    ImGuiContext& g = *GImGui;
+    return g.InputRecorder.Replaying;
+}
+
+int ImGui::GetInputRecordingFramesCount()
+{
+    ImGuiContext& g = *GImGui;
+    return g.InputRecorder.FramesCount;
+}
+
+
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerBeginScope() / ProfilerEndScope() are called via the IMGUI_PROFILER_SCOPE() etc. macros, which compile
+//   to nothing unless IMGUI_ENABLE_PROFILER is defined.
+// - Every scope is forwarded to the user callbacks, and optionally recorded in a ring buffer of frames which can
+//   be saved in the Chrome trace event format ("X" complete events, timestamps in microseconds).
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+static ImU64 ProfilerGetTimeNs()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    LARGE_INTEGER counter, frequency;
+    ::QueryPerformanceCounter(&counter);
+    ::QueryPerformanceFrequency(&frequency);
+    return (ImU64)((double)counter.QuadPart * 1000000000.0 / (double)frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    return (ImU64)((double)clock() * 1000000000.0 / CLOCKS_PER_SEC);
+#endif
+}
+
+// Called at the very beginning of NewFrame(), before any scope is opened for the new frame.
+static void ImGui::ProfilerNewFrame(ImGuiContext* ctx)
+{
+    // Close scopes left open by a frame which didn't reach EndFrame() (e.g. the implicit "Debug##Default" window)
+    ImGuiProfiler& profiler = ctx->Profiler;
+    while (profiler.Stack.Size > 0)
+        ProfilerEndScope();
+    if (profiler.Frames.Size == 0)
+        return;
+    profiler.FramesHead = (profiler.FramesHead + 1) % profiler.Frames.Size;
+    profiler.FramesCount = ImMin(profiler.FramesCount + 1, profiler.Frames.Size);
+    ImGuiProfilerFrame* frame = profiler.Frames[profiler.FramesHead];
+    frame->FrameCount = ctx->FrameCount + 1;
+    frame->TimeBegin = ProfilerGetTimeNs();
+    frame->Events.resize(0);
+    frame->Strings.Buf.resize(0);
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
+void ImGui::ProfilerBeginScope(const char* name, const char* detail)
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    if (profiler.BeginFn)
+        profiler.BeginFn(name, detail, profiler.UserData);
+
+    ImGuiProfilerStackEntry entry;
+    entry.Name = name;
+    entry.Detail = detail;
+    entry.FrameCount = -1;
+    entry.EventIndex = -1;
+    if (profiler.FramesHead >= 0)
+    {
+        ImGuiProfilerFrame* frame = profiler.Frames[profiler.FramesHead];
+        ImGuiProfilerEvent ev;
+        ev.Name = name;
+        ev.DetailOffset = -1;
+        if (detail)
+        {
+            ev.DetailOffset = frame->Strings.size();
+            frame->Strings.append(detail, detail + strlen(detail) + 1); // Keep zero-terminator
+        }
+        ev.Depth = profiler.Stack.Size;
+        ev.TimeEnd = 0;
+        entry.FrameCount = frame->FrameCount;
+        entry.EventIndex = frame->Events.Size;
+        frame->Events.push_back(ev);
+        frame->Events.back().TimeBegin = ProfilerGetTimeNs();   // Last, to exclude our own overhead
+    }
+    profiler.Stack.push_back(entry);
+#else
+    IM_UNUSED(name);
+    IM_UNUSED(detail);
+#endif
+}
+
+void ImGui::ProfilerEndScope()
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    IM_ASSERT(profiler.Stack.Size > 0 && "Mismatched ProfilerBeginScope()/ProfilerEndScope() calls!");
+    const ImGuiProfilerStackEntry& entry = profiler.Stack.back();
+    if (entry.EventIndex >= 0)
+    {
+        const ImU64 time = ProfilerGetTimeNs();
+        // The scope may have been opened during a previous frame, whose slot may since have been recycled.
+        for (int n = 0; n < profiler.FramesCount; n++)
+        {
+            ImGuiProfilerFrame* frame = profiler.Frames[(profiler.FramesHead - n + profiler.Frames.Size) % profiler.Frames.Size];
+            if (frame->FrameCount == entry.FrameCount)
+            {
+                frame->Events[entry.EventIndex].TimeEnd = time;
+                break;
+            }
+        }
+    }
+    if (profiler.EndFn)
+        profiler.EndFn(entry.Name, entry.Detail, profiler.UserData);
+    profiler.Stack.pop_back();
+#endif
+}
+
+void ImGui::SetProfilerCallbacks(ImGuiProfilerScopeCallback begin_fn, ImGuiProfilerScopeCallback end_fn, void* user_data)
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Profiler.Stack.Size == 0 && "Cannot change profiler callbacks while a scope is open, e.g. between NewFrame() and Render()!");
+    g.Profiler.BeginFn = begin_fn;
+    g.Profiler.EndFn = end_fn;
+    g.Profiler.UserData = user_data;
+#else
+    IM_UNUSED(begin_fn);
+    IM_UNUSED(end_fn);
+    IM_UNUSED(user_data);
+#endif
+}
+
+void ImGui::SetProfilerRecordFrames(int frames_count)
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    IM_ASSERT(frames_count >= 0);
+    for (int n = 0; n < profiler.Frames.Size; n++)
+        IM_DELETE(profiler.Frames[n]);
+    profiler.Frames.clear();
+    profiler.FramesHead = -1;
+    profiler.FramesCount = 0;
+    for (int n = 0; n < frames_count; n++)
+        profiler.Frames.push_back(IM_NEW(ImGuiProfilerFrame)());
+
+    // Events of currently open scopes are gone, don't try to close them.
+    for (int n = 0; n < profiler.Stack.Size; n++)
+        profiler.Stack[n].EventIndex = -1;
+#else
+    IM_UNUSED(frames_count);
+#endif
+}
+
+#ifdef IMGUI_ENABLE_PROFILER
+static void ProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    for (const char* p = str; *p; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if (c < 0x20)
+            buf->appendf("\\u%04x", c);
+        else
+            buf->append(p, p + 1);
+    }
+    buf->append("\"");
+}
+#endif
+
+const char* ImGui::SaveProfilerTraceToMemory(size_t* out_size)
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& profiler = g.Profiler;
+    ImGuiTextBuffer* buf = &profiler.TraceData;
+    buf->Buf.resize(0);
+    buf->Buf.push_back(0);
+    buf->append("{\"traceEvents\":[");
+    bool first = true;
+    ImU64 time_origin = 0;
+    for (int frame_n = profiler.FramesCount - 1; frame_n >= 0; frame_n--) // Oldest to newest
+    {
+        const ImGuiProfilerFrame* frame = profiler.Frames[(profiler.FramesHead - frame_n + profiler.Frames.Size) % profiler.Frames.Size];
+        if (first)
+            time_origin = frame->TimeBegin;
+
+        // One event spanning the whole frame (until the last recorded scope ended), then the scopes themselves
+        ImU64 frame_end = frame->TimeBegin;
+        for (int ev_n = 0; ev_n < frame->Events.Size; ev_n++)
+            frame_end = ImMax(frame_end, frame->Events[ev_n].TimeEnd);
+        buf->appendf("%s\n{\"name\":\"Frame %d\",\"cat\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d}}",
+            first ? "" : ",", frame->FrameCount, (double)(frame->TimeBegin - time_origin) / 1000.0, (double)(frame_end - frame->TimeBegin) / 1000.0, frame->FrameCount);
+        first = false;
+        for (int ev_n = 0; ev_n < frame->Events.Size; ev_n++)
+        {
+            const ImGuiProfilerEvent& ev = frame->Events[ev_n];
+            if (ev.TimeEnd == 0)
+                continue; // Still open
+            const char* detail = frame->GetDetail(ev);
+            buf->append(",\n{\"name\":");
+            ProfilerAppendJsonString(buf, detail ? detail : ev.Name);
+            buf->append(",\"cat\":");
+            ProfilerAppendJsonString(buf, ev.Name);
+            buf->appendf(",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d,\"depth\":%d}}",
+                (double)(ev.TimeBegin - time_origin) / 1000.0, (double)(ev.TimeEnd - ev.TimeBegin) / 1000.0, frame->FrameCount, ev.Depth);
+        }
+    }
+    buf->append("\n],\"displayTimeUnit\":\"ms\"}\n");
+    if (out_size)
+        *out_size = (size_t)buf->size();
+    return buf->c_str();
+#else
+    if (out_size)
+        *out_size = 0;
+    return "";
+#endif
+}
+
+bool ImGui::SaveProfilerTraceToDisk(const char* filename)
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    if (g.Profiler.FramesCount == 0)
+        return false;
+    size_t data_size = 0;
+    const char* data = SaveProfilerTraceToMemory(&data_size);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(data, sizeof(char), data_size, f) == (ImU64)data_size;
+    ImFileClose(f);
+    return ret;
+#else
+    IM_UNUSED(filename);
+    return false;
+#endif
+}
+
+
 //-----------------------------------------------------------------------------
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 //-----------------------------------------------------------------------------
@@ -10000,8 +11909,12 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    if (g.DebugDrawVertSaturatedCount > 0)
+        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%d vertex positions clamped to the compact ImDrawVert range!", g.DebugDrawVertSaturatedCount);
+#endif
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
-    ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
+    ImGui::Text("%d active allocations, %d allocations during last frame", io.MetricsActiveAllocations, io.MetricsFrameAllocations);
     ImGui::Separator();
 
     // Helper functions to display common structures:
@@ -10126,10 +12039,11 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                         ImVec2 triangle[3];
                         for (int n = 0; n < 3; n++, idx_i++)
                         {
-                            ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                            const ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                            const ImVec2 uv = v.uv;
                             triangle[n] = v.pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                                (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                                (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                         }
 
                         ImGui::Selectable(buf, false);
@@ -10197,6 +12111,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
             ImGui::BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
             ImGui::BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+            if (window->DrawCache.ContentHash != 0)
+                ImGui::BulletText("ContentHash: 0x%08X, DrawCache: %s", window->DrawCache.ContentHash, window->DrawCache.Replaying ? "Reused" : window->DrawCache.CachedContentHash ? "Recorded" : "None");
             ImGui::BulletText("NavLastIds: 0x%08X,0x%08X, NavLayerActiveMask: %X", window->NavLastIds[0], window->NavLastIds[1], window->DC.NavLayerActiveMask);
             ImGui::BulletText("NavLastChildNavWindow: %s", window->NavLastChildNavWindow ? window->NavLastChildNavWindow->Name : "NULL");
             if (!window->NavRectRel[0].IsInverted())
@@ -10206,13 +12122,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             if (window->RootWindow != window) NodeWindow(window->RootWindow, "RootWindow");
             if (window->ParentWindow != NULL) NodeWindow(window->ParentWindow, "ParentWindow");
             if (window->DC.ChildWindows.Size > 0) NodeWindows(window->DC.ChildWindows, "ChildWindows");
-            if (window->ColumnsStorage.Size > 0 && ImGui::TreeNode("Columns", "Columns sets (%d)", window->ColumnsStorage.Size))
+            if (window->ColumnsStorage.GetSize() > 0 && ImGui::TreeNode("Columns", "Columns sets (%d)", window->ColumnsStorage.GetSize()))
             {
-                for (int n = 0; n < window->ColumnsStorage.Size; n++)
-                    NodeColumns(&window->ColumnsStorage[n]);
+                for (int n = 0; n < window->ColumnsStorage.GetSize(); n++)
+                    NodeColumns(window->ColumnsStorage.GetByIndex(n));
                 ImGui::TreePop();
             }
             NodeStorage(&window->StateStorage, "Storage");
+            if (window->StateStorageUsage.GetSize() > 0)
+                ImGui::BulletText("Storage usage tracked for %d entries, last compacted %.2f sec ago", window->StateStorageUsage.GetSize(), (float)ImGui::GetTime() - window->StateStorageGcTime);
             ImGui::TreePop();
         }
 
@@ -10332,6 +12250,75 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
 #endif // #define IMGUI_HAS_DOCK
 
+    // Details for Memory
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    if (ImGui::TreeNode("Memory", "Memory (%d KB in %d allocations)", g.MemAllocStats[ImGuiMemAllocTag_COUNT].LiveBytes / 1024, g.MemAllocStats[ImGuiMemAllocTag_COUNT].LiveCount))
+    {
+        ImGui::Columns(6, "##memory", false);
+        const char* headers[] = { "Tag", "Live KB", "Peak KB", "Live count", "Allocs/frame", "KB/frame" };
+        for (int n = 0; n < IM_ARRAYSIZE(headers); n++)
+        {
+            ImGui::TextUnformatted(headers[n]);
+            ImGui::NextColumn();
+        }
+        ImGui::Separator();
+        for (int tag = 0; tag <= ImGuiMemAllocTag_COUNT; tag++)
+        {
+            const ImGuiMemAllocStats* stats = GetMemAllocStats(tag);
+            ImGui::TextUnformatted(GetMemAllocTagName(tag)); ImGui::NextColumn();
+            ImGui::Text("%.1f", stats->LiveBytes / 1024.0f); ImGui::NextColumn();
+            ImGui::Text("%.1f", stats->PeakBytes / 1024.0f); ImGui::NextColumn();
+            ImGui::Text("%d", stats->LiveCount); ImGui::NextColumn();
+            ImGui::Text("%d", stats->FrameAllocCount); ImGui::NextColumn();
+            ImGui::Text("%.1f", stats->FrameAllocBytes / 1024.0f); ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::TreePop();
+    }
+#endif // #ifdef IMGUI_ENABLE_ALLOC_TRACKING
+
+    // Details for Memory Budget
+    const ImGuiMemoryBudgetStats& budget_stats = g.MemoryBudgetStats;
+    if (ImGui::TreeNode("Memory Budget", "Memory Budget (%d/%d KB, %d KB reclaimed)", io.MetricsMemoryUsage / 1024, io.ConfigMemoryBudget / 1024, io.MetricsMemoryReclaimed / 1024))
+    {
+        ImGui::Text("Window compactions: %d, last at frame %d", budget_stats.CompactedWindows, budget_stats.LastFrame);
+        ImGui::BulletText("Draw lists: %.1f KB", budget_stats.DrawLists / 1024.0f);
+        ImGui::BulletText("Columns: %.1f KB", budget_stats.Columns / 1024.0f);
+        ImGui::BulletText("Storage: %.1f KB", budget_stats.Storage / 1024.0f);
+        ImGui::BulletText("Tab bars: %.1f KB", budget_stats.TabBars / 1024.0f);
+        ImGui::BulletText("InputText: %.1f KB", budget_stats.InputText / 1024.0f);
+        ImGui::Text("Storage entries removed: %d", budget_stats.StorageEntries);
+        if (g.MemoryBudgetBackoffUsage != 0)
+            ImGui::Text("Backing off until usage exceeds %d KB", (g.MemoryBudgetBackoffUsage + io.ConfigMemoryBudget / 16) / 1024);
+        ImGui::TreePop();
+    }
+
+    // Details for Profiler
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler& profiler = g.Profiler;
+    if (ImGui::TreeNode("Profiler", "Profiler (%d/%d frames recorded)", profiler.FramesCount, profiler.Frames.Size))
+    {
+        if (ImGui::SmallButton(profiler.Frames.Size > 0 ? "Stop recording" : "Record 120 frames"))
+            SetProfilerRecordFrames(profiler.Frames.Size > 0 ? 0 : 120);
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Save to imgui_trace.json"))
+            SaveProfilerTraceToDisk("imgui_trace.json");
+        if (profiler.FramesCount >= 2)
+        {
+            // Previous frame, as the current one is still being recorded
+            const ImGuiProfilerFrame* frame = profiler.Frames[(profiler.FramesHead - 1 + profiler.Frames.Size) % profiler.Frames.Size];
+            ImGui::Text("Frame %d:", frame->FrameCount);
+            for (int ev_n = 0; ev_n < frame->Events.Size; ev_n++)
+            {
+                const ImGuiProfilerEvent& ev = frame->Events[ev_n];
+                const char* detail = frame->GetDetail(ev);
+                ImGui::BulletText("%*s%s%s%s: %.3f ms", ev.Depth * 2, "", ev.Name, detail ? " " : "", detail ? detail : "", ev.TimeEnd ? (double)(ev.TimeEnd - ev.TimeBegin) / 1000000.0 : 0.0);
+            }
+        }
+        ImGui::TreePop();
+    }
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
     // Misc Details
     if (ImGui::TreeNode("Internal state"))
     {
@@ -10350,6 +12337,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::Text("NavDisableHighlight: %d, NavDisableMouseHover: %d", g.NavDisableHighlight, g.NavDisableMouseHover);
         ImGui::Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
         ImGui::Text("DragDrop: %d, SourceId = 0x%08X, Payload \"%s\" (%d bytes)", g.DragDropActive, g.DragDropPayload.SourceId, g.DragDropPayload.DataType, g.DragDropPayload.DataSize);
+        ImGui::Text("InputRecorder: Recording: %d, Replaying: %d (frame %d/%d, %d bytes)", g.InputRecorder.Recording, g.InputRecorder.Replaying, g.InputRecorder.ReplayFrame, g.InputRecorder.FramesCount, g.InputRecorder.Data.Size);
         ImGui::TreePop();
     }
 
@@ -26,6 +26,7 @@ Index of this file:
 // Memory allocations macros
 // ImVector<>
 // ImGuiStyle
+// ImGuiMemAllocStats
 // ImGuiIO
 // Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // Obsolete functions
@@ -117,7 +118,7 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
@@ -128,6 +129,7 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiMemAllocStats;          // Memory allocation statistics for one subsystem (see GetMemAllocStats())
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
@@ -148,6 +150,7 @@ typedef int ImGuiKey;               // -> enum ImGuiKey_             // Enum: A
 typedef int ImGuiNavInput;          // -> enum ImGuiNavInput_        // Enum: An input identifier for navigation
 typedef int ImGuiMouseButton;       // -> enum ImGuiMouseButton_     // Enum: A mouse button identifier (0=left, 1=right, 2=middle)
 typedef int ImGuiMouseCursor;       // -> enum ImGuiMouseCursor_     // Enum: A mouse cursor identifier
+typedef int ImGuiMemAllocTag;       // -> enum ImGuiMemAllocTag_     // Enum: A subsystem identifier for memory allocation statistics
 typedef int ImGuiStyleVar;          // -> enum ImGuiStyleVar_        // Enum: A variable identifier for styling
 typedef int ImDrawCornerFlags;      // -> enum ImDrawCornerFlags_    // Flags: for ImDrawList::AddRect(), AddRectFilled() etc.
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList
@@ -174,6 +177,7 @@ typedef void* ImTextureID;          // User data for rendering back-end to ident
 typedef unsigned int ImGuiID;       // A unique ID used by widgets, typically hashed from a stack of string.
 typedef int (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData *data);
 typedef void (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);
+typedef void (*ImGuiProfilerScopeCallback)(const char* name, const char* detail, void* user_data); // See SetProfilerCallbacks(). 'detail' may be NULL.
 
 // Decoded character types
 // (we generally use UTF-8 encoded string in the API. This is storage specifically for a decoded character used for keyboard input and display)
@@ -237,6 +241,7 @@ namespace ImGui
 {
     // Context creation and access
     // Each context create its own ImFontAtlas by default. You may instance one yourself and pass it to CreateContext() to share a font atlas between imgui contexts.
+    // To share a font atlas between contexts used from different threads, call ImFontAtlas::LockForSharing() on it first.
     // None of those functions is reliant on the current context.
     IMGUI_API ImGuiContext* CreateContext(ImFontAtlas* shared_font_atlas = NULL);
     IMGUI_API void          DestroyContext(ImGuiContext* ctx = NULL);   // NULL = destroy current context
@@ -309,6 +314,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                 // set next window collapsed state. call before Begin()
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily override the Alpha component of ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
+    IMGUI_API void          SetNextWindowContentHash(ImGuiID content_hash);                             // set next window content hash (0 = disabled). when equal to last frame and the window isn't hovered/focused/active, Begin() returns false and last frame draw list is reused: skip submitting items, still call End(). the hash must cover everything your content depends on.
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0,0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -687,6 +693,7 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
+    IMGUI_API void          SetupDetachedDrawList(ImDrawList* draw_list);                       // reset your own ImDrawList instance so it can be filled from any thread during this frame, then appended with GetWindowDrawList()->AddDrawList(). It inherits the current window clip rectangle and texture.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -746,12 +753,44 @@ namespace ImGui
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
 
+    // Input Recording/Replay
+    // - Record the inputs read by each NewFrame() (DisplaySize, DeltaTime, mouse, keys, characters, nav inputs) into a compact binary blob, stored as deltas between frames.
+    // - Replay them frame-for-frame into another context running the same UI code (e.g. headless, see examples/example_null_benchmark/), to reproduce and time a frame sequence.
+    // - Recordings also store io.KeyMap[] and io.ConfigFlags, which are applied when the replay starts. The data is stored in native endianness.
+    IMGUI_API void          StartInputRecording();                                              // start recording the inputs of the following frames. clears previous recording, stops replaying.
+    IMGUI_API void          StopInputRecording();                                               // stop recording or replaying.
+    IMGUI_API bool          SaveInputRecordingToDisk(const char* filename);                     // return false if nothing was recorded or the file could not be written.
+    IMGUI_API const void*   SaveInputRecordingToMemory(size_t* out_size = NULL);                // return the recording data, valid until the next call to StartInputRecording() or LoadInputRecordingXXX().
+    IMGUI_API bool          LoadInputRecordingFromDisk(const char* filename);                   // start replaying: each following NewFrame() overwrites io inputs with the next recorded frame. return false if the data is invalid.
+    IMGUI_API bool          LoadInputRecordingFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool          IsInputReplaying();                                                 // true while recorded frames remain to be replayed by the next NewFrame() calls.
+    IMGUI_API int           GetInputRecordingFramesCount();                                     // number of frames recorded so far, or in the recording being replayed.
+
+    // Profiler Utilities
+    // - Requires '#define IMGUI_ENABLE_PROFILER' in imconfig.h, otherwise those functions do nothing.
+    // - Scopes are emitted for the main phases of NewFrame()/EndFrame()/Render(), and for each Begin()/End() pair with the window name as detail.
+    // - Forward them to your own tracing system with callbacks, and/or keep the last N frames in the built-in recorder and save them as a Chrome trace (open with chrome://tracing or ui.perfetto.dev).
+    IMGUI_API void          SetProfilerCallbacks(ImGuiProfilerScopeCallback begin_fn, ImGuiProfilerScopeCallback end_fn, void* user_data = NULL); // called on the thread running the context. pass NULL to disable.
+    IMGUI_API void          SetProfilerRecordFrames(int frames_count);                          // keep the last 'frames_count' frames in the built-in recorder (0: disabled, default). clears previous recording.
+    IMGUI_API bool          SaveProfilerTraceToDisk(const char* filename);                      // save recorded frames as a Chrome trace .json file. return false if nothing was recorded or the file could not be written.
+    IMGUI_API const char*   SaveProfilerTraceToMemory(size_t* out_size = NULL);                 // return a zero-terminated string with the Chrome trace .json data, valid until the next call.
+
+    // Memory Statistics
+    // - Requires '#define IMGUI_ENABLE_ALLOC_TRACKING' in imconfig.h, otherwise all statistics stay zero.
+    // - Allocations are accounted to the context which is current when they are made/freed, and to the subsystem which made them.
+    IMGUI_API const ImGuiMemAllocStats* GetMemAllocStats(ImGuiMemAllocTag tag);               // statistics of the current context for one subsystem. tag == ImGuiMemAllocTag_COUNT returns the total.
+    IMGUI_API const char*   GetMemAllocTagName(ImGuiMemAllocTag tag);
+
     // Debug Utilities
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    IMGUI_API void          DebugNotifyDrawVertSaturated();                                     // Called when an ImDrawVert position is out of the IMGUI_USE_COMPACT_DRAWVERT range. Put a breakpoint here to find the culprit.
+#endif
 
     // Memory Allocators
     // - All those functions are not reliant on the current context.
     // - If you reload the contents of imgui.cpp at runtime, you may need to call SetCurrentContext() + SetAllocatorFunctions() again because we use global storage for those.
+    // - With IMGUI_USE_THREAD_LOCAL_CONTEXT, SetAllocatorFunctions() only affects the calling thread, and each context keeps using the functions that were set when it was created.
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
@@ -1270,6 +1309,22 @@ enum ImGuiCond_
     ImGuiCond_Appearing     = 1 << 3    // Set the variable if the object/window is appearing after being hidden/inactive (or the first time)
 };
 
+// Enumeration for GetMemAllocStats()
+// Subsystems that memory allocations are accounted to (requires IMGUI_ENABLE_ALLOC_TRACKING)
+enum ImGuiMemAllocTag_
+{
+    ImGuiMemAllocTag_Misc,          // Everything else (ID stack, style stacks, user ImVector<> etc.)
+    ImGuiMemAllocTag_DrawLists,     // ImDrawList vertex/index/command buffers, ImDrawData
+    ImGuiMemAllocTag_Fonts,         // ImFontAtlas data and texture, ImFont glyphs and lookup tables
+    ImGuiMemAllocTag_TextEdit,      // InputText() state and buffers
+    ImGuiMemAllocTag_Storage,       // ImGuiStorage/ImGuiHashStorage entries
+    ImGuiMemAllocTag_Settings,      // .ini settings
+    ImGuiMemAllocTag_Windows,       // ImGuiWindow and per-window data
+    ImGuiMemAllocTag_Columns,       // Columns
+    ImGuiMemAllocTag_TabBars,       // Tab bars and tab items
+    ImGuiMemAllocTag_COUNT
+};
+
 //-----------------------------------------------------------------------------
 // Helpers: Memory allocations macros
 // IM_MALLOC(), IM_FREE(), IM_NEW(), IM_PLACEMENT_NEW(), IM_DELETE()
@@ -1396,7 +1451,9 @@ struct ImGuiStyle
     ImVec2      DisplaySafeAreaPadding;     // If you cannot see the edges of your screen (e.g. on a TV) increase the safe area padding. Apply to popups/tooltips as well regular windows. NB: Prefer configuring your TV sets correctly!
     float       MouseCursorScale;           // Scale software rendered mouse cursor (when io.MouseDrawCursor is enabled). May be removed later.
     bool        AntiAliasedLines;           // Enable anti-aliasing on lines/borders. Disable if you are really tight on CPU/GPU.
+    bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require back-end to render with bilinear filtering. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliasing on filled shapes (rounded rectangles, circles, etc.)
+    bool        RoundCornersUseTex;         // Enable anti-aliased rounded rectangles and small circles using textures where possible. Require back-end to render with bilinear filtering. Latched at the beginning of the frame (copied to ImDrawList).
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleSegmentMaxError;      // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
     ImVec4      Colors[ImGuiCol_COUNT];
@@ -1405,6 +1462,24 @@ struct ImGuiStyle
     IMGUI_API void ScaleAllSizes(float scale_factor);
 };
 
+//-----------------------------------------------------------------------------
+// ImGuiMemAllocStats
+// Memory allocation statistics for one subsystem, see GetMemAllocStats().
+//-----------------------------------------------------------------------------
+
+struct ImGuiMemAllocStats
+{
+    int         LiveBytes;              // Size of the allocations currently alive, in bytes (not including allocator overhead)
+    int         PeakBytes;              // Highest value reached by LiveBytes
+    int         LiveCount;              // Number of allocations currently alive
+    int         FrameAllocCount;        // Number of allocations made during the last frame (from one NewFrame() to the next)
+    int         FrameAllocBytes;        // Size of the allocations made during the last frame, in bytes
+    int         CurrFrameAllocCount;    // [Internal] Accumulators for the frame in progress
+    int         CurrFrameAllocBytes;
+
+    ImGuiMemAllocStats()    { memset(this, 0, sizeof(*this)); }
+};
+
 //-----------------------------------------------------------------------------
 // ImGuiIO
 // Communicate most settings and inputs/outputs to Dear ImGui using this structure.
@@ -1445,6 +1520,9 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
     float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused. Set to -1.0f to disable.
+    int         ConfigWindowsStorageGcFrames;   // = 0              // [BETA] When > 0, track when the tree node/collapsing header open states stored in windows are used, and remove the ones unused for that many frames or equal to their default, every ConfigWindowsMemoryCompactTimer seconds (never when it is -1.0f).
+    int         ConfigMemoryBudget;             // = 0              // [BETA] When > 0 and the memory used by the library exceeds this many bytes, compact inactive windows in least recently used order. Measured with IMGUI_ENABLE_ALLOC_TRACKING (excluding fonts), estimated from the main buffers otherwise. Active windows, settings and the context itself can't be reclaimed: set it above the usage of your steady state.
+    bool        ConfigDrawDataHash;             // = false          // Hash draw data in Render() to fill ImDrawData::ContentHash/ContentUnchanged, so you can skip rendering frames identical to the previous one.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1512,12 +1590,16 @@ struct ImGuiIO
     bool        WantSaveIniSettings;            // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
     bool        NavActive;                      // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                     // Keyboard/Gamepad navigation is visible and allowed (will handle ImGuiKey_NavXXX events).
+    float       NextFrameDelay;                 // Set by EndFrame(): delay in seconds before Dear ImGui needs a new frame if no new inputs are received (text cursor blink, hover delays, navigation/fading animations). 0.0f: as soon as possible, FLT_MAX: idle. Doesn't know about your own animations!
     float       Framerate;                      // Application framerate estimate, in frame per second. Solely for convenience. Rolling average estimation based on io.DeltaTime over 120 frames.
     int         MetricsRenderVertices;          // Vertices output during last call to Render()
     int         MetricsRenderIndices;           // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
-    int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts (unless using IMGUI_USE_THREAD_LOCAL_CONTEXT).
+    int         MetricsFrameAllocations;        // Number of allocations made by MemAlloc during the last frame (from one NewFrame() to the next), based on current context. Should be 0 once the application is in a steady state.
+    int         MetricsMemoryUsage;             // Memory used by the library as compared to io.ConfigMemoryBudget, updated by NewFrame() when a budget is set.
+    int         MetricsMemoryReclaimed;         // Number of bytes reclaimed to honor io.ConfigMemoryBudget since the context was created (details in Metrics window).
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -1850,6 +1932,16 @@ struct ImColor
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
+// The maximum line width to bake anti-aliased textures for. Build atlas with ImFontAtlasFlags_NoBakedLines to disable baking.
+#ifndef IM_DRAWLIST_TEX_LINES_WIDTH_MAX
+#define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (63)
+#endif
+
+// The maximum radius of rounded corners/circles to bake anti-aliased textures for. Build atlas with ImFontAtlasFlags_NoBakedRoundCorners to disable baking.
+#ifndef IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX
+#define IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX    (16)
+#endif
+
 // ImDrawCallback: Draw callbacks for advanced uses [configurable type: override in imconfig.h]
 // NB: You most likely do NOT need to use draw callbacks just to create your own widget or customized UI rendering,
 // you can poke into the draw list for that! Draw callback may be useful for example to:
@@ -1891,7 +1983,53 @@ typedef unsigned short ImDrawIdx;
 #endif
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact vertex layout (12 bytes), see IMGUI_USE_COMPACT_DRAWVERT in imconfig.h.
+// Fields are read/written as float/ImVec2 and converted to fixed point on assignment, so code writing to ImDrawVert doesn't need to know about the layout.
+// Renderer back-ends need to declare 'pos' as 2 x signed 16-bit integers divided by IM_DRAWVERT_POS_SCALE (e.g. folded in the projection matrix),
+// and 'uv' as 2 x unsigned 16-bit normalized integers (e.g. GL_UNSIGNED_SHORT + normalized=GL_TRUE, VK_FORMAT_R16G16_UNORM).
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT are incompatible."
+#endif
+#ifndef IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS    2
+#endif
+#define IM_DRAWVERT_POS_SCALE                   (1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS)
+#define IM_DRAWVERT_UV_SCALE                    (0xFFFF)
+template<typename T, int SCALE, int MIN, int MAX>
+struct ImDrawVertFixed
+{
+    T                   v;
+    ImDrawVertFixed&    operator=(float f)
+    {
+        f = f * SCALE + (f >= 0.0f ? 0.5f : -0.5f);
+        if (f > (float)(MIN - 1) && f < (float)(MAX + 1))
+            v = (T)(int)f;
+        else
+        {
+            v = (T)(f < 0.0f ? MIN : MAX);              // Saturate (NaN goes to MAX). Clamping UVs is expected, clamping positions bends slanted primitives (see imconfig.h).
+            if (MIN < 0)
+                ImGui::DebugNotifyDrawVertSaturated();
+        }
+        return *this;
+    }
+    operator            float() const       { return (float)v * (1.0f / SCALE); }
+};
+template<typename T>
+struct ImDrawVertFixedVec2
+{
+    T                       x, y;
+    ImDrawVertFixedVec2&    operator=(const ImVec2& rhs)    { x = rhs.x; y = rhs.y; return *this; }
+    ImDrawVertFixedVec2&    operator+=(const ImVec2& rhs)   { x = x + rhs.x; y = y + rhs.y; return *this; }
+    operator                ImVec2() const                  { return ImVec2(x, y); }
+};
+struct ImDrawVert
+{
+    ImDrawVertFixedVec2<ImDrawVertFixed<ImS16, IM_DRAWVERT_POS_SCALE, -32768, 32767> >  pos;
+    ImDrawVertFixedVec2<ImDrawVertFixed<ImU16, IM_DRAWVERT_UV_SCALE, 0, 65535> >        uv;
+    ImU32   col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -1946,10 +2084,13 @@ enum ImDrawCornerFlags_
 
 enum ImDrawListFlags_
 {
-    ImDrawListFlags_None             = 0,
-    ImDrawListFlags_AntiAliasedLines = 1 << 0,  // Lines are anti-aliased (*2 the number of triangles for 1.0f wide line, otherwise *3 the number of triangles)
-    ImDrawListFlags_AntiAliasedFill  = 1 << 1,  // Filled shapes have anti-aliased edges (*2 the number of vertices)
-    ImDrawListFlags_AllowVtxOffset   = 1 << 2   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_None                   = 0,
+    ImDrawListFlags_AntiAliasedLines       = 1 << 0,  // Lines are anti-aliased (*2 the number of triangles for 1.0f wide line, otherwise *3 the number of triangles)
+    ImDrawListFlags_AntiAliasedFill        = 1 << 1,  // Filled shapes have anti-aliased edges (*2 the number of vertices)
+    ImDrawListFlags_AllowVtxOffset         = 1 << 2,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_SharedEdgeLines        = 1 << 3,  // Non-AA lines share vertices between segments (miter/bevel joins). Opt-in.
+    ImDrawListFlags_AntiAliasedLinesUseTex = 1 << 4,  // Use textures baked in the atlas for integer-thickness AA lines (needs bilinear filtering)
+    ImDrawListFlags_RoundCornersUseTex     = 1 << 5   // Use textures baked in the atlas for AA rounded rectangles and small circles (needs bilinear filtering)
 };
 
 // Draw command list
@@ -2037,6 +2178,7 @@ struct ImDrawList
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API void  AddDrawList(const ImDrawList* src);                         // Append the output of another draw list, e.g. filled on a worker thread (see ImGui::SetupDetachedDrawList()). Its clip rectangles are intersected with the current one.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -2077,11 +2219,13 @@ struct ImDrawData
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
+    ImU64           ContentHash;            // Hash of all draw lists + display parameters. Only computed when io.ConfigDrawDataHash is set, 0 otherwise.
+    bool            ContentUnchanged;       // Set when ContentHash is equal to the previous frame's, aka the output is identical to last frame (save for hash collisions) and you may skip rendering/presenting it.
 
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); ContentHash = 0; ContentUnchanged = false; } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
@@ -2159,15 +2303,19 @@ struct ImFontAtlasCustomRect
 
 enum ImFontAtlasFlags_
 {
-    ImFontAtlasFlags_None               = 0,
-    ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1    // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_None                = 0,
+    ImFontAtlasFlags_NoPowerOfTwoHeight  = 1 << 0,   // Don't round the height to next power of two
+    ImFontAtlasFlags_NoMouseCursors      = 1 << 1,   // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_NoBakedLines        = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedRoundCorners = 1 << 3    // Don't build rounded corner/circle textures into the atlas (save texture memory). The RoundCornersUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
 //  - One or more fonts.
 //  - Custom graphics data needed to render the shapes needed by Dear ImGui.
 //  - Mouse cursor shapes for software cursor rendering (unless setting 'Flags |= ImFontAtlasFlags_NoMouseCursors' in the font atlas).
+//  - Pre-filtered anti-aliased lines of integer widths (unless setting 'Flags |= ImFontAtlasFlags_NoBakedLines' in the font atlas).
+//  - Pre-filtered anti-aliased rounded squares and 1 pixel rings of integer radii for rounded rectangles and circles (unless setting 'Flags |= ImFontAtlasFlags_NoBakedRoundCorners' in the font atlas).
 // It is the user-code responsibility to setup/build the atlas, then upload the pixel data into a texture accessible by your graphics api.
 //  - Optionally, call any of the AddFont*** functions. If you don't call any, the default font embedded in the code will be loaded for you.
 //  - Call GetTexDataAsAlpha8() or GetTexDataAsRGBA32() to build and retrieve pixels data.
@@ -2207,6 +2355,13 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Share a single atlas between many contexts, including contexts running on different threads (see IMGUI_USE_THREAD_LOCAL_CONTEXT).
+    // - LockForSharing() builds the atlas if needed, then makes it and its fonts permanently read-only: any modification will assert.
+    //   Call GetTexDataAsRGBA32() and SetTexID() before locking if you need them, as they can't be changed afterward.
+    // - Pass the atlas to CreateContext(). Contexts hold a reference which is released by DestroyContext(), the atlas asserts if destroyed while still referenced.
+    IMGUI_API bool              LockForSharing();
+    bool                        IsLockedForSharing() const  { return LockedForSharing; }
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2245,6 +2400,7 @@ struct ImFontAtlas
     //-------------------------------------------
 
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    bool                        LockedForSharing;   // Permanently locked by LockForSharing(). Atlas and fonts are read-only and may be used by multiple contexts/threads concurrently.
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
@@ -2258,10 +2414,14 @@ struct ImFontAtlas
     int                         TexHeight;          // Texture height calculated during Build().
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
+    ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines, indexed by width in pixels (x,y = left edge, z,w = right edge)
+    ImVec4                      TexUvRoundCornersFill[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 1];   // UVs for baked anti-aliased rounded squares, indexed by radius in pixels (x,y = min, z,w = max)
+    ImVec4                      TexUvRoundCornersStroke[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 1]; // UVs for baked anti-aliased 1 pixel rings, indexed by radius in pixels (x,y = min, z,w = max)
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Internal data
-    int                         CustomRectIds[1];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList
+    int                         CustomRectIds[3];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList: [0] mouse cursors or white pixels, [1] baked lines, [2] baked round corners
+    int                         RefCount;           // Number of contexts using this atlas as their shared_font_atlas. Updated atomically.
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
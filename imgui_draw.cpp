@@ -35,6 +35,15 @@ Index of this file:
 #include "imgui_internal.h"
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+
+// SIMD code paths (AddPolyline), disabled with IMGUI_DISABLE_SIMD. SSE2 is always available on x64. NEON paths require AArch64 (for vdivq_f32/vsqrtq_f32).
+#if !defined(IMGUI_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>  // _mm_loadu_ps, _mm_sqrt_ps...
+#define IMGUI_DRAW_SSE2
+#elif !defined(IMGUI_DISABLE_SIMD) && defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>   // vld2q_f32, vsqrtq_f32...
+#define IMGUI_DRAW_NEON
+#endif
 #if !defined(alloca)
 #if defined(__GLIBC__) || defined(__sun) || defined(__CYGWIN__) || defined(__APPLE__) || defined(__SWITCH__)
 #include <alloca.h>     // alloca (glibc uses <alloca.h>. Note that Cygwin may have _WIN32 defined, so the order matters here)
@@ -347,6 +356,8 @@ void ImGui::StyleColorsLight(ImGuiStyle* dst)
 
 ImDrawListSharedData::ImDrawListSharedData()
 {
+    TexUvLines = NULL;
+    TexUvRoundCornersFill = TexUvRoundCornersStroke = NULL;
     Font = NULL;
     FontSize = 0.0f;
     CurveTessellationTol = 0.0f;
@@ -408,6 +419,7 @@ void ImDrawList::ClearFreeMemory()
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_DrawLists);
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
@@ -422,6 +434,7 @@ ImDrawList* ImDrawList::CloneOutput() const
 
 void ImDrawList::AddDrawCmd()
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_DrawLists);
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = GetCurrentClipRect();
     draw_cmd.TextureId = GetCurrentTextureId();
@@ -486,6 +499,90 @@ void ImDrawList::UpdateTextureID()
         curr_cmd->TextureId = curr_texture_id;
 }
 
+// Append the output of another draw list, typically a detached draw list filled from a worker thread (see ImGui::SetupDetachedDrawList()).
+// - Clipping rectangles are intersected with our current clipping rectangle, commands which end up fully clipped are skipped.
+// - Vertices are copied as-is, indices are rebased. With 16-bit indices, a new VtxOffset is started when needed (requires ImDrawListFlags_AllowVtxOffset).
+void ImDrawList::AddDrawList(const ImDrawList* src)
+{
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_DrawLists);
+    IM_ASSERT(src != this && src->_Splitter._Count <= 1);
+    if (src->CmdBuffer.Size == 0)
+        return;
+
+    const ImVec4 curr_clip_rect = GetCurrentClipRect();
+    const unsigned int vtx_base = (unsigned int)VtxBuffer.Size;
+    VtxBuffer.resize(VtxBuffer.Size + src->VtxBuffer.Size);
+    memcpy(VtxBuffer.Data + vtx_base, src->VtxBuffer.Data, (size_t)src->VtxBuffer.Size * sizeof(ImDrawVert));
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+
+    if (CmdBuffer.Size > 0 && CmdBuffer.back().ElemCount == 0 && CmdBuffer.back().UserCallback == NULL)
+        CmdBuffer.pop_back();
+    CmdBuffer.reserve(CmdBuffer.Size + src->CmdBuffer.Size + 1);
+    IdxBuffer.reserve(IdxBuffer.Size + src->IdxBuffer.Size);
+
+    for (int cmd_n = 0; cmd_n < src->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* src_cmd = &src->CmdBuffer.Data[cmd_n];
+        if (src_cmd->ElemCount == 0 && src_cmd->UserCallback == NULL)
+            continue;
+        ImVec4 clip_rect(ImMax(src_cmd->ClipRect.x, curr_clip_rect.x), ImMax(src_cmd->ClipRect.y, curr_clip_rect.y), ImMin(src_cmd->ClipRect.z, curr_clip_rect.z), ImMin(src_cmd->ClipRect.w, curr_clip_rect.w));
+        if (src_cmd->UserCallback != NULL)
+        {
+            ImDrawCmd draw_cmd = *src_cmd;
+            draw_cmd.ClipRect = ImVec4(clip_rect.x, clip_rect.y, ImMax(clip_rect.x, clip_rect.z), ImMax(clip_rect.y, clip_rect.w));
+            draw_cmd.VtxOffset = _VtxCurrentOffset;
+            draw_cmd.IdxOffset = IdxBuffer.Size;
+            CmdBuffer.push_back(draw_cmd);
+            continue;
+        }
+        if (clip_rect.x >= clip_rect.z || clip_rect.y >= clip_rect.w)
+            continue;
+
+        // With 16-bit indices, vertices used by this command are within [vtx_first, vtx_first + 64K)
+        const unsigned int vtx_first = vtx_base + src_cmd->VtxOffset;
+        if (sizeof(ImDrawIdx) == 2)
+        {
+            const unsigned int vtx_end = vtx_first + ImMin((unsigned int)src->VtxBuffer.Size - src_cmd->VtxOffset, (unsigned int)(1 << 16));
+            if (vtx_end - _VtxCurrentOffset > (1 << 16) && (Flags & ImDrawListFlags_AllowVtxOffset))
+                _VtxCurrentOffset = vtx_first;
+            IM_ASSERT(vtx_end - _VtxCurrentOffset <= (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
+        }
+        const unsigned int idx_delta = vtx_first - _VtxCurrentOffset;
+
+        ImDrawCmd* prev_cmd = CmdBuffer.Size > 0 ? &CmdBuffer.back() : NULL;
+        if (prev_cmd && prev_cmd->UserCallback == NULL && prev_cmd->TextureId == src_cmd->TextureId && prev_cmd->VtxOffset == _VtxCurrentOffset && prev_cmd->IdxOffset + prev_cmd->ElemCount == (unsigned int)IdxBuffer.Size && memcmp(&prev_cmd->ClipRect, &clip_rect, sizeof(ImVec4)) == 0)
+        {
+            prev_cmd->ElemCount += src_cmd->ElemCount;
+        }
+        else
+        {
+            ImDrawCmd draw_cmd;
+            draw_cmd.ClipRect = clip_rect;
+            draw_cmd.TextureId = src_cmd->TextureId;
+            draw_cmd.VtxOffset = _VtxCurrentOffset;
+            draw_cmd.IdxOffset = IdxBuffer.Size;
+            draw_cmd.ElemCount = src_cmd->ElemCount;
+            CmdBuffer.push_back(draw_cmd);
+        }
+
+        const int idx_old_size = IdxBuffer.Size;
+        IdxBuffer.resize(idx_old_size + (int)src_cmd->ElemCount);
+        const ImDrawIdx* idx_read = src->IdxBuffer.Data + src_cmd->IdxOffset;
+        ImDrawIdx* idx_write = IdxBuffer.Data + idx_old_size;
+        if (idx_delta == 0)
+            memcpy(idx_write, idx_read, (size_t)src_cmd->ElemCount * sizeof(ImDrawIdx));
+        else
+            for (unsigned int n = 0; n < src_cmd->ElemCount; n++)
+                idx_write[n] = (ImDrawIdx)(idx_read[n] + idx_delta);
+    }
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    _VtxCurrentIdx = VtxBuffer.Size - _VtxCurrentOffset;
+
+    // Restore a command matching our current state
+    UpdateClipRect();
+    UpdateTextureID();
+}
+
 #undef GetCurrentClipRect
 #undef GetCurrentTextureId
 
@@ -538,6 +635,7 @@ void ImDrawList::PopTextureID()
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_DrawLists);
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -620,6 +718,91 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 #define IM_FIXNORMAL2F(VX,VY)               do { float d2 = VX*VX + VY*VY; if (d2 < 0.5f) d2 = 0.5f; float inv_lensq = 1.0f / d2; VX *= inv_lensq; VY *= inv_lensq; } while (0)
 
+// Disable floating-point contraction (fusing a*b+c into a FMA instruction, e.g. with -march=native on x86 or by default with GCC on ARM)
+// for AddPolyline(): the SIMD path computes the same operations as the scalar path, but they may be contracted differently.
+// This keeps both paths bit-exact with GCC and Clang (except with Clang's -ffp-contract=fast) and MSVC (except with /fp:fast or /fp:contract).
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+// Helpers for AddPolyline(), anti-aliased path.
+// Normal of segment p1->p2.
+static inline void AddPolylineCalcNormal(const ImVec2& p1, const ImVec2& p2, float& out_nx, float& out_ny)
+{
+    float dx = p2.x - p1.x;
+    float dy = p2.y - p1.y;
+    IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+    out_nx = dy;
+    out_ny = -dx;
+}
+
+// Vertices of one point given its (averaged) normal: center + 2 fringes for thin lines, 2 inner + 2 fringes for thick lines,
+// 2 edges sampling a line baked in the atlas for textured lines (the fringes are in the texture).
+// 'half_width' is the half inner thickness for thick lines, the half width of the quad for textured lines.
+static inline void AddPolylineWriteVtx(ImDrawVert*& vtx, const ImVec2& p, float dm_x, float dm_y, const ImVec4* tex_uvs, bool thick_line, float half_width, const ImVec2& uv, ImU32 col, ImU32 col_trans)
+{
+    const float AA_SIZE = 1.0f;
+    if (tex_uvs)
+    {
+        const float dm_out_x = dm_x * half_width;
+        const float dm_out_y = dm_y * half_width;
+        vtx[0].pos.x = p.x + dm_out_x; vtx[0].pos.y = p.y + dm_out_y; vtx[0].uv.x = tex_uvs->x; vtx[0].uv.y = tex_uvs->y; vtx[0].col = col;
+        vtx[1].pos.x = p.x - dm_out_x; vtx[1].pos.y = p.y - dm_out_y; vtx[1].uv.x = tex_uvs->z; vtx[1].uv.y = tex_uvs->w; vtx[1].col = col;
+        vtx += 2;
+    }
+    else if (!thick_line)
+    {
+        vtx[0].pos = p;                                     vtx[0].uv = uv; vtx[0].col = col;
+        vtx[1].pos.x = p.x + dm_x; vtx[1].pos.y = p.y + dm_y; vtx[1].uv = uv; vtx[1].col = col_trans;
+        vtx[2].pos.x = p.x - dm_x; vtx[2].pos.y = p.y - dm_y; vtx[2].uv = uv; vtx[2].col = col_trans;
+        vtx += 3;
+    }
+    else
+    {
+        const float dm_out_x = dm_x * (half_width + AA_SIZE);
+        const float dm_out_y = dm_y * (half_width + AA_SIZE);
+        const float dm_in_x = dm_x * half_width;
+        const float dm_in_y = dm_y * half_width;
+        vtx[0].pos.x = p.x + dm_out_x; vtx[0].pos.y = p.y + dm_out_y; vtx[0].uv = uv; vtx[0].col = col_trans;
+        vtx[1].pos.x = p.x + dm_in_x;  vtx[1].pos.y = p.y + dm_in_y;  vtx[1].uv = uv; vtx[1].col = col;
+        vtx[2].pos.x = p.x - dm_in_x;  vtx[2].pos.y = p.y - dm_in_y;  vtx[2].uv = uv; vtx[2].col = col;
+        vtx[3].pos.x = p.x - dm_out_x; vtx[3].pos.y = p.y - dm_out_y; vtx[3].uv = uv; vtx[3].col = col_trans;
+        vtx += 4;
+    }
+}
+
+// Indexes of the segment joining the vertices of two points.
+static inline void AddPolylineWriteIdx(ImDrawIdx*& idx, unsigned int idx1, unsigned int idx2, bool use_texture, bool thick_line)
+{
+    if (use_texture)
+    {
+        idx[0] = (ImDrawIdx)(idx2+0); idx[1] = (ImDrawIdx)(idx1+0); idx[2] = (ImDrawIdx)(idx1+1);
+        idx[3] = (ImDrawIdx)(idx2+1); idx[4] = (ImDrawIdx)(idx1+1); idx[5] = (ImDrawIdx)(idx2+0);
+        idx += 6;
+    }
+    else if (!thick_line)
+    {
+        idx[0] = (ImDrawIdx)(idx2+0); idx[1] = (ImDrawIdx)(idx1+0); idx[2] = (ImDrawIdx)(idx1+2);
+        idx[3] = (ImDrawIdx)(idx1+2); idx[4] = (ImDrawIdx)(idx2+2); idx[5] = (ImDrawIdx)(idx2+0);
+        idx[6] = (ImDrawIdx)(idx2+1); idx[7] = (ImDrawIdx)(idx1+1); idx[8] = (ImDrawIdx)(idx1+0);
+        idx[9] = (ImDrawIdx)(idx1+0); idx[10]= (ImDrawIdx)(idx2+0); idx[11]= (ImDrawIdx)(idx2+1);
+        idx += 12;
+    }
+    else
+    {
+        idx[0]  = (ImDrawIdx)(idx2+1); idx[1]  = (ImDrawIdx)(idx1+1); idx[2]  = (ImDrawIdx)(idx1+2);
+        idx[3]  = (ImDrawIdx)(idx1+2); idx[4]  = (ImDrawIdx)(idx2+2); idx[5]  = (ImDrawIdx)(idx2+1);
+        idx[6]  = (ImDrawIdx)(idx2+1); idx[7]  = (ImDrawIdx)(idx1+1); idx[8]  = (ImDrawIdx)(idx1+0);
+        idx[9]  = (ImDrawIdx)(idx1+0); idx[10] = (ImDrawIdx)(idx2+0); idx[11] = (ImDrawIdx)(idx2+1);
+        idx[12] = (ImDrawIdx)(idx2+2); idx[13] = (ImDrawIdx)(idx1+2); idx[14] = (ImDrawIdx)(idx1+3);
+        idx[15] = (ImDrawIdx)(idx1+3); idx[16] = (ImDrawIdx)(idx2+3); idx[17] = (ImDrawIdx)(idx2+2);
+        idx += 18;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
@@ -637,144 +820,225 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     if (Flags & ImDrawListFlags_AntiAliasedLines)
     {
         // Anti-aliased stroke
+        // Single pass: the normal of each segment is computed once and averaged with the previous one to emit the vertices of each point,
+        // followed by the indexes of the segment joining it to the previous point. Interior points are processed 4 at a time with SSE2/NEON.
         const float AA_SIZE = 1.0f;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
 
-        const int idx_count = thick_line ? count*18 : count*12;
-        const int vtx_count = thick_line ? points_count*4 : points_count*3;
+        // Lines of integer thickness sample a pre-filtered line baked in the font atlas (see ImFontAtlasBuildRenderLinesTexData), which
+        // only needs 2 vertices per point and 1 quad per segment. Other lines build their fringes with geometry.
+        const int integer_thickness = (int)thickness;
+        const float fractional_thickness = thickness - (float)integer_thickness;
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && _Data->TexUvLines != NULL && integer_thickness >= 1 && integer_thickness <= IM_DRAWLIST_TEX_LINES_WIDTH_MAX && fractional_thickness <= 0.00001f;
+        const ImVec4* tex_uvs = use_texture ? &_Data->TexUvLines[integer_thickness] : NULL;
+        const float half_width = use_texture ? (thickness * 0.5f + AA_SIZE) : ((thickness - AA_SIZE) * 0.5f);
+
+        const int idx_count = use_texture ? count*6 : thick_line ? count*18 : count*12;
+        const int vtx_count = use_texture ? points_count*2 : thick_line ? points_count*4 : points_count*3;
         PrimReserve(idx_count, vtx_count);
 
-        // Temporary buffer
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * (thick_line ? 5 : 3) * sizeof(ImVec2)); //-V630
-        ImVec2* temp_points = temp_normals + points_count;
+        const unsigned int vtx_stride = use_texture ? 2 : thick_line ? 4 : 3;
+        const unsigned int idx_base = _VtxCurrentIdx;
 
-        for (int i1 = 0; i1 < count; i1++)
+        // First point: closed lines average the normals of the closing segment and first segment, open lines use the first segment normal.
+        float prev_nx, prev_ny;
+        AddPolylineCalcNormal(points[0], points[1], prev_nx, prev_ny);
+        if (closed)
         {
-            const int i2 = (i1+1) == points_count ? 0 : i1+1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
+            float last_nx, last_ny;
+            AddPolylineCalcNormal(points[points_count - 1], points[0], last_nx, last_ny);
+            float dm_x = (last_nx + prev_nx) * 0.5f;
+            float dm_y = (last_ny + prev_ny) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            AddPolylineWriteVtx(_VtxWritePtr, points[0], dm_x, dm_y, tex_uvs, thick_line, half_width, uv, col, col_trans);
+        }
+        else
+        {
+            AddPolylineWriteVtx(_VtxWritePtr, points[0], prev_nx, prev_ny, tex_uvs, thick_line, half_width, uv, col, col_trans);
         }
-        if (!closed)
-            temp_normals[points_count-1] = temp_normals[points_count-2];
 
-        if (!thick_line)
+        int i = 1;
+#if defined(IMGUI_DRAW_SSE2) || defined(IMGUI_DRAW_NEON)
+        // Interior points, 4 at a time: points i..i+3 and the segments i..i+3 starting from them (requires points i..i+4).
+        // This uses the same operations as IM_NORMALIZE2F_OVER_ZERO()/IM_FIXNORMAL2F(), which are exactly rounded, so the output matches the scalar path
+        // as long as neither is contracted into FMA instructions (see above).
+        for (; i + 4 < points_count; i += 4)
         {
-            if (!closed)
+            float dm_x[4], dm_y[4];
+#ifdef IMGUI_DRAW_SSE2
+            const __m128 p01 = _mm_loadu_ps(&points[i].x), p23 = _mm_loadu_ps(&points[i + 2].x);
+            const __m128 q01 = _mm_loadu_ps(&points[i + 1].x), q23 = _mm_loadu_ps(&points[i + 3].x);
+            __m128 dx = _mm_sub_ps(_mm_shuffle_ps(q01, q23, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0)));
+            __m128 dy = _mm_sub_ps(_mm_shuffle_ps(q01, q23, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1)));
+            __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            const __m128 non_zero = _mm_cmpgt_ps(d2, _mm_setzero_ps());
+            const __m128 inv_len = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(d2));
+            dx = _mm_or_ps(_mm_and_ps(non_zero, _mm_mul_ps(dx, inv_len)), _mm_andnot_ps(non_zero, dx));
+            dy = _mm_or_ps(_mm_and_ps(non_zero, _mm_mul_ps(dy, inv_len)), _mm_andnot_ps(non_zero, dy));
+            const __m128 nx = dy;
+            const __m128 ny = _mm_xor_ps(dx, _mm_set1_ps(-0.0f));
+            const __m128 prev_nx4 = _mm_move_ss(_mm_shuffle_ps(nx, nx, _MM_SHUFFLE(2, 1, 0, 0)), _mm_set_ss(prev_nx));
+            const __m128 prev_ny4 = _mm_move_ss(_mm_shuffle_ps(ny, ny, _MM_SHUFFLE(2, 1, 0, 0)), _mm_set_ss(prev_ny));
+            __m128 ax = _mm_mul_ps(_mm_add_ps(prev_nx4, nx), _mm_set1_ps(0.5f));
+            __m128 ay = _mm_mul_ps(_mm_add_ps(prev_ny4, ny), _mm_set1_ps(0.5f));
+            d2 = _mm_max_ps(_mm_set1_ps(0.5f), _mm_add_ps(_mm_mul_ps(ax, ax), _mm_mul_ps(ay, ay)));
+            const __m128 inv_lensq = _mm_div_ps(_mm_set1_ps(1.0f), d2);
+            _mm_storeu_ps(dm_x, _mm_mul_ps(ax, inv_lensq));
+            _mm_storeu_ps(dm_y, _mm_mul_ps(ay, inv_lensq));
+            prev_nx = _mm_cvtss_f32(_mm_shuffle_ps(nx, nx, _MM_SHUFFLE(3, 3, 3, 3)));
+            prev_ny = _mm_cvtss_f32(_mm_shuffle_ps(ny, ny, _MM_SHUFFLE(3, 3, 3, 3)));
+#else
+            const float32x4x2_t p = vld2q_f32(&points[i].x);
+            const float32x4x2_t q = vld2q_f32(&points[i + 1].x);
+            float32x4_t dx = vsubq_f32(q.val[0], p.val[0]);
+            float32x4_t dy = vsubq_f32(q.val[1], p.val[1]);
+            float32x4_t d2 = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+            const uint32x4_t non_zero = vcgtq_f32(d2, vdupq_n_f32(0.0f));
+            const float32x4_t inv_len = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(d2));
+            dx = vbslq_f32(non_zero, vmulq_f32(dx, inv_len), dx);
+            dy = vbslq_f32(non_zero, vmulq_f32(dy, inv_len), dy);
+            const float32x4_t nx = dy;
+            const float32x4_t ny = vnegq_f32(dx);
+            const float32x4_t prev_nx4 = vextq_f32(vdupq_n_f32(prev_nx), nx, 3);
+            const float32x4_t prev_ny4 = vextq_f32(vdupq_n_f32(prev_ny), ny, 3);
+            const float32x4_t ax = vmulq_f32(vaddq_f32(prev_nx4, nx), vdupq_n_f32(0.5f));
+            const float32x4_t ay = vmulq_f32(vaddq_f32(prev_ny4, ny), vdupq_n_f32(0.5f));
+            d2 = vaddq_f32(vmulq_f32(ax, ax), vmulq_f32(ay, ay));
+            d2 = vbslq_f32(vcltq_f32(d2, vdupq_n_f32(0.5f)), vdupq_n_f32(0.5f), d2);
+            const float32x4_t inv_lensq = vdivq_f32(vdupq_n_f32(1.0f), d2);
+            vst1q_f32(dm_x, vmulq_f32(ax, inv_lensq));
+            vst1q_f32(dm_y, vmulq_f32(ay, inv_lensq));
+            prev_nx = vgetq_lane_f32(nx, 3);
+            prev_ny = vgetq_lane_f32(ny, 3);
+#endif
+            for (int n = 0; n < 4; n++)
             {
-                temp_points[0] = points[0] + temp_normals[0] * AA_SIZE;
-                temp_points[1] = points[0] - temp_normals[0] * AA_SIZE;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * AA_SIZE;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * AA_SIZE;
+                AddPolylineWriteVtx(_VtxWritePtr, points[i + n], dm_x[n], dm_y[n], tex_uvs, thick_line, half_width, uv, col, col_trans);
+                AddPolylineWriteIdx(_IdxWritePtr, idx_base + (i + n - 1) * vtx_stride, idx_base + (i + n) * vtx_stride, use_texture, thick_line);
             }
+        }
+#endif
 
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
-            for (int i1 = 0; i1 < count; i1++)
+        // Remaining points. The last point of an open line reuses the normal of the last segment.
+        for (; i < points_count; i++)
+        {
+            float nx = prev_nx, ny = prev_ny;
+            if (i + 1 < points_count)
+                AddPolylineCalcNormal(points[i], points[i + 1], nx, ny);
+            else if (closed)
+                AddPolylineCalcNormal(points[i], points[0], nx, ny);
+            float dm_x = (prev_nx + nx) * 0.5f;
+            float dm_y = (prev_ny + ny) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            AddPolylineWriteVtx(_VtxWritePtr, points[i], dm_x, dm_y, tex_uvs, thick_line, half_width, uv, col, col_trans);
+            AddPolylineWriteIdx(_IdxWritePtr, idx_base + (i - 1) * vtx_stride, idx_base + i * vtx_stride, use_texture, thick_line);
+            prev_nx = nx;
+            prev_ny = ny;
+        }
+        if (closed)
+            AddPolylineWriteIdx(_IdxWritePtr, idx_base + (points_count - 1) * vtx_stride, idx_base, use_texture, thick_line);
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else if (Flags & ImDrawListFlags_SharedEdgeLines)
+    {
+        // Non Anti-aliased Stroke, sharing vertices between consecutive segments
+        // Each point emits 2 vertices for a miter join. When the miter would be longer than MITER_LIMIT * half thickness, it emits a bevel join:
+        // both segments end square on the point (4 vertices) and a triangle fills the gap on the outer side. Open lines have butt caps.
+        const float MITER_LIMIT = 2.0f;
+        const float half_thickness = thickness * 0.5f;
+        const int idx_count = count*6 + points_count*3;     // Worst case (all bevel joins), unused space is released below
+        const int vtx_count = points_count*4;
+        PrimReserve(idx_count, vtx_count);
+        const ImDrawVert* vtx_write_start = _VtxWritePtr;
+        const ImDrawIdx* idx_write_start = _IdxWritePtr;
+
+        // Normal of the segment ending on the current point. Zero-length segments reuse the previous normal.
+        float prev_nx = 0.0f, prev_ny = 0.0f;
+        if (closed)
+            AddPolylineCalcNormal(points[points_count - 1], points[0], prev_nx, prev_ny);
+        unsigned int idx = _VtxCurrentIdx;
+        unsigned int first_in_plus = 0, first_in_minus = 0, prev_out_plus = 0, prev_out_minus = 0;
+        for (int i = 0; i < points_count; i++)
+        {
+            const ImVec2 p = points[i];
+            float nx = prev_nx, ny = prev_ny;
+            if (i + 1 < points_count || closed)
             {
-                const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+3;
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= AA_SIZE;
-                dm_y *= AA_SIZE;
-
-                // Add temporary vertexes
-                ImVec2* out_vtx = &temp_points[i2*2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                // Add indexes
-                _IdxWritePtr[0] = (ImDrawIdx)(idx2+0); _IdxWritePtr[1] = (ImDrawIdx)(idx1+0); _IdxWritePtr[2] = (ImDrawIdx)(idx1+2);
-                _IdxWritePtr[3] = (ImDrawIdx)(idx1+2); _IdxWritePtr[4] = (ImDrawIdx)(idx2+2); _IdxWritePtr[5] = (ImDrawIdx)(idx2+0);
-                _IdxWritePtr[6] = (ImDrawIdx)(idx2+1); _IdxWritePtr[7] = (ImDrawIdx)(idx1+1); _IdxWritePtr[8] = (ImDrawIdx)(idx1+0);
-                _IdxWritePtr[9] = (ImDrawIdx)(idx1+0); _IdxWritePtr[10]= (ImDrawIdx)(idx2+0); _IdxWritePtr[11]= (ImDrawIdx)(idx2+1);
-                _IdxWritePtr += 12;
-
-                idx1 = idx2;
+                float seg_nx, seg_ny;
+                AddPolylineCalcNormal(p, points[(i + 1 < points_count) ? i + 1 : 0], seg_nx, seg_ny);
+                if (seg_nx != 0.0f || seg_ny != 0.0f)
+                {
+                    nx = seg_nx;
+                    ny = seg_ny;
+                }
+            }
+            if (prev_nx == 0.0f && prev_ny == 0.0f)
+            {
+                prev_nx = nx;
+                prev_ny = ny;
             }
 
-            // Add vertexes
-            for (int i = 0; i < points_count; i++)
+            // Vertices for this point. The "in" pair connects to the previous segment, the "out" pair to the next one.
+            unsigned int in_plus, in_minus, out_plus, out_minus;
+            const float dm_x = (prev_nx + nx) * 0.5f;
+            const float dm_y = (prev_ny + ny) * 0.5f;
+            const float d2 = dm_x*dm_x + dm_y*dm_y;
+            if (d2 * (MITER_LIMIT * MITER_LIMIT) >= 1.0f)
             {
-                _VtxWritePtr[0].pos = points[i];          _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-                _VtxWritePtr[1].pos = temp_points[i*2+0]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;
-                _VtxWritePtr[2].pos = temp_points[i*2+1]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col_trans;
-                _VtxWritePtr += 3;
+                const float miter_scale = half_thickness / d2;
+                _VtxWritePtr[0].pos.x = p.x + dm_x * miter_scale; _VtxWritePtr[0].pos.y = p.y + dm_y * miter_scale; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+                _VtxWritePtr[1].pos.x = p.x - dm_x * miter_scale; _VtxWritePtr[1].pos.y = p.y - dm_y * miter_scale; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr += 2;
+                in_plus = out_plus = idx;
+                in_minus = out_minus = idx + 1;
+                idx += 2;
             }
-        }
-        else
-        {
-            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
-            if (!closed)
+            else
             {
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[(points_count-1)*4+0] = points[points_count-1] + temp_normals[points_count-1] * (half_inner_thickness + AA_SIZE);
-                temp_points[(points_count-1)*4+1] = points[points_count-1] + temp_normals[points_count-1] * (half_inner_thickness);
-                temp_points[(points_count-1)*4+2] = points[points_count-1] - temp_normals[points_count-1] * (half_inner_thickness);
-                temp_points[(points_count-1)*4+3] = points[points_count-1] - temp_normals[points_count-1] * (half_inner_thickness + AA_SIZE);
+                const float in_x = prev_nx * half_thickness, in_y = prev_ny * half_thickness;
+                const float out_x = nx * half_thickness, out_y = ny * half_thickness;
+                _VtxWritePtr[0].pos.x = p.x + in_x;  _VtxWritePtr[0].pos.y = p.y + in_y;  _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+                _VtxWritePtr[1].pos.x = p.x - in_x;  _VtxWritePtr[1].pos.y = p.y - in_y;  _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = p.x + out_x; _VtxWritePtr[2].pos.y = p.y + out_y; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = p.x - out_x; _VtxWritePtr[3].pos.y = p.y - out_y; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+                _VtxWritePtr += 4;
+
+                // The outer side of the join is the side opposite to the direction the line turns to.
+                const unsigned int outer = (prev_ny * nx - prev_nx * ny > 0.0f) ? 1 : 0;
+                _IdxWritePtr[0] = (ImDrawIdx)(idx+outer); _IdxWritePtr[1] = (ImDrawIdx)(idx+2+outer); _IdxWritePtr[2] = (ImDrawIdx)(idx+1-outer);
+                _IdxWritePtr += 3;
+                in_plus = idx;
+                in_minus = idx + 1;
+                out_plus = idx + 2;
+                out_minus = idx + 3;
+                idx += 4;
             }
 
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
-            for (int i1 = 0; i1 < count; i1++)
+            // Segment from the previous point
+            if (i > 0)
             {
-                const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+4;
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertexes
-                ImVec2* out_vtx = &temp_points[i2*4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
-                _IdxWritePtr[0]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1+2);
-                _IdxWritePtr[3]  = (ImDrawIdx)(idx1+2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2+2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2+1);
-                _IdxWritePtr[6]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1+0);
-                _IdxWritePtr[9]  = (ImDrawIdx)(idx1+0); _IdxWritePtr[10] = (ImDrawIdx)(idx2+0); _IdxWritePtr[11] = (ImDrawIdx)(idx2+1);
-                _IdxWritePtr[12] = (ImDrawIdx)(idx2+2); _IdxWritePtr[13] = (ImDrawIdx)(idx1+2); _IdxWritePtr[14] = (ImDrawIdx)(idx1+3);
-                _IdxWritePtr[15] = (ImDrawIdx)(idx1+3); _IdxWritePtr[16] = (ImDrawIdx)(idx2+3); _IdxWritePtr[17] = (ImDrawIdx)(idx2+2);
-                _IdxWritePtr += 18;
-
-                idx1 = idx2;
+                _IdxWritePtr[0] = (ImDrawIdx)prev_out_plus; _IdxWritePtr[1] = (ImDrawIdx)in_plus; _IdxWritePtr[2] = (ImDrawIdx)in_minus;
+                _IdxWritePtr[3] = (ImDrawIdx)prev_out_plus; _IdxWritePtr[4] = (ImDrawIdx)in_minus; _IdxWritePtr[5] = (ImDrawIdx)prev_out_minus;
+                _IdxWritePtr += 6;
             }
-
-            // Add vertexes
-            for (int i = 0; i < points_count; i++)
+            else
             {
-                _VtxWritePtr[0].pos = temp_points[i*4+0]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i*4+1]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i*4+2]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i*4+3]; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
+                first_in_plus = in_plus;
+                first_in_minus = in_minus;
             }
+            prev_out_plus = out_plus;
+            prev_out_minus = out_minus;
+            prev_nx = nx;
+            prev_ny = ny;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        if (closed)
+        {
+            _IdxWritePtr[0] = (ImDrawIdx)prev_out_plus; _IdxWritePtr[1] = (ImDrawIdx)first_in_plus; _IdxWritePtr[2] = (ImDrawIdx)first_in_minus;
+            _IdxWritePtr[3] = (ImDrawIdx)prev_out_plus; _IdxWritePtr[4] = (ImDrawIdx)first_in_minus; _IdxWritePtr[5] = (ImDrawIdx)prev_out_minus;
+            _IdxWritePtr += 6;
+        }
+        PrimUnreserve(idx_count - (int)(_IdxWritePtr - idx_write_start), vtx_count - (int)(_VtxWritePtr - vtx_write_start));
+        _VtxCurrentIdx = idx;
     }
     else
     {
@@ -809,6 +1073,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     }
 }
 
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT DEFAULT
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
 // We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
 {
@@ -983,10 +1253,17 @@ void ImDrawList::PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImV
     }
 }
 
-void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
+// Clamp rounding so that the corners of a side fit in it
+static inline float PathRectClampRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
 {
     rounding = ImMin(rounding, ImFabs(b.x - a.x) * ( ((rounding_corners & ImDrawCornerFlags_Top)  == ImDrawCornerFlags_Top)  || ((rounding_corners & ImDrawCornerFlags_Bot)   == ImDrawCornerFlags_Bot)   ? 0.5f : 1.0f ) - 1.0f);
     rounding = ImMin(rounding, ImFabs(b.y - a.y) * ( ((rounding_corners & ImDrawCornerFlags_Left) == ImDrawCornerFlags_Left) || ((rounding_corners & ImDrawCornerFlags_Right) == ImDrawCornerFlags_Right) ? 0.5f : 1.0f ) - 1.0f);
+    return rounding;
+}
+
+void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
+{
+    rounding = PathRectClampRounding(a, b, rounding, rounding_corners);
 
     if (rounding <= 0.0f || rounding_corners == 0)
     {
@@ -1017,12 +1294,81 @@ void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float th
     PathStroke(col, false, thickness);
 }
 
+// Radius of the rounded square/ring baked in the font atlas for a given rounding, 0 if none (non-integer or out of range).
+static inline int GetRoundCornersTexRadius(float rounding)
+{
+    const int radius = (int)rounding;
+    return (radius >= 1 && radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX && rounding - (float)radius <= 0.00001f) ? radius : 0;
+}
+
+// Rounded rectangle sampling a rounded square/ring baked in the font atlas (see ImFontAtlasBuildRenderRoundCornersTexData), 9-slice style:
+// a 4x4 vertex grid extending 'margin' outside of the rectangle (the transparent outer texels of the box), where corner cells map to
+// the quarters of the box and edge cells sample its middle row/column of texels, which hold the profile of a straight edge.
+// Non-rounded corners (fills only) are drawn as a separate quad sampling the opaque middle of the box.
+static void AddRoundCornersTex(ImDrawList* draw_list, const ImVec2& p_min, const ImVec2& p_max, float corner_size, float margin, const ImVec4& uvs, ImU32 col, ImDrawCornerFlags rounding_corners, bool fill)
+{
+    const float x[4] = { p_min.x - margin, p_min.x + corner_size, p_max.x - corner_size, p_max.x + margin };
+    const float y[4] = { p_min.y - margin, p_min.y + corner_size, p_max.y - corner_size, p_max.y + margin };
+    const ImVec2 uv_mid((uvs.x + uvs.z) * 0.5f, (uvs.y + uvs.w) * 0.5f);
+    const float u[4] = { uvs.x, uv_mid.x, uv_mid.x, uvs.z };
+    const float v[4] = { uvs.y, uv_mid.y, uv_mid.y, uvs.w };
+    const ImDrawCornerFlags cell_corners[9] = { ImDrawCornerFlags_TopLeft, 0, ImDrawCornerFlags_TopRight, 0, 0, 0, ImDrawCornerFlags_BotLeft, 0, ImDrawCornerFlags_BotRight };
+
+    int square_corners_count = 0;
+    for (int n = 0; n < 9; n++)
+        if (cell_corners[n] != 0 && !(rounding_corners & cell_corners[n]))
+            square_corners_count++;
+    IM_ASSERT(fill || square_corners_count == 0);
+    draw_list->PrimReserve((fill ? 9 : 8) * 6, 16 + square_corners_count * 4); // The middle of a ring is transparent
+
+    const unsigned int idx = draw_list->_VtxCurrentIdx;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    for (int j = 0; j < 4; j++)
+        for (int i = 0; i < 4; i++, vtx_write++)
+        {
+            vtx_write->pos.x = x[i]; vtx_write->pos.y = y[j]; vtx_write->uv.x = u[i]; vtx_write->uv.y = v[j]; vtx_write->col = col;
+        }
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    for (int n = 0; n < 9; n++)
+    {
+        if ((n == 4 && !fill) || (cell_corners[n] != 0 && !(rounding_corners & cell_corners[n])))
+            continue;
+        const unsigned int cell_idx = idx + (n / 3) * 4 + (n % 3);
+        idx_write[0] = (ImDrawIdx)(cell_idx); idx_write[1] = (ImDrawIdx)(cell_idx+1); idx_write[2] = (ImDrawIdx)(cell_idx+5);
+        idx_write[3] = (ImDrawIdx)(cell_idx); idx_write[4] = (ImDrawIdx)(cell_idx+5); idx_write[5] = (ImDrawIdx)(cell_idx+4);
+        idx_write += 6;
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx += 16;
+
+    if (square_corners_count > 0)
+    {
+        if (!(rounding_corners & ImDrawCornerFlags_TopLeft))  draw_list->PrimRectUV(ImVec2(p_min.x, p_min.y), ImVec2(x[1], y[1]), uv_mid, uv_mid, col);
+        if (!(rounding_corners & ImDrawCornerFlags_TopRight)) draw_list->PrimRectUV(ImVec2(x[2], p_min.y), ImVec2(p_max.x, y[1]), uv_mid, uv_mid, col);
+        if (!(rounding_corners & ImDrawCornerFlags_BotLeft))  draw_list->PrimRectUV(ImVec2(p_min.x, y[2]), ImVec2(x[1], p_max.y), uv_mid, uv_mid, col);
+        if (!(rounding_corners & ImDrawCornerFlags_BotRight)) draw_list->PrimRectUV(ImVec2(x[2], y[2]), ImVec2(p_max.x, p_max.y), uv_mid, uv_mid, col);
+    }
+}
+
 // p_min = upper-left, p_max = lower-right
 // Note we don't render 1 pixels sized rectangles properly.
 void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners, float thickness)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+
+    // 1 pixel thick outline with all corners rounded: the stroke is centered on the outer row/column of pixels, with the rounding of PathRect()
+    if ((Flags & ImDrawListFlags_AntiAliasedLines) && (Flags & ImDrawListFlags_RoundCornersUseTex) && _Data->TexUvRoundCornersStroke != NULL && thickness == 1.0f && rounding > 0.0f && (rounding_corners & ImDrawCornerFlags_All) == ImDrawCornerFlags_All)
+    {
+        const int radius = GetRoundCornersTexRadius(PathRectClampRounding(p_min + ImVec2(0.50f,0.50f), p_max - ImVec2(0.50f,0.50f), rounding, rounding_corners));
+        if (radius > 0 && p_max.x - p_min.x >= radius * 2.0f + 1.0f && p_max.y - p_min.y >= radius * 2.0f + 1.0f)
+        {
+            AddRoundCornersTex(this, p_min, p_max, radius + 0.5f, 1.0f, _Data->TexUvRoundCornersStroke[radius], col, rounding_corners, false);
+            return;
+        }
+    }
+
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(p_min + ImVec2(0.50f,0.50f), p_max - ImVec2(0.50f,0.50f), rounding, rounding_corners);
     else
@@ -1036,6 +1382,15 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
         return;
     if (rounding > 0.0f)
     {
+        if ((Flags & ImDrawListFlags_AntiAliasedFill) && (Flags & ImDrawListFlags_RoundCornersUseTex) && _Data->TexUvRoundCornersFill != NULL && (rounding_corners & ImDrawCornerFlags_All) != 0)
+        {
+            const int radius = GetRoundCornersTexRadius(PathRectClampRounding(p_min, p_max, rounding, rounding_corners));
+            if (radius > 0 && p_max.x - p_min.x >= radius * 2.0f + 2.0f && p_max.y - p_min.y >= radius * 2.0f + 2.0f)
+            {
+                AddRoundCornersTex(this, p_min, p_max, radius + 1.0f, 1.0f, _Data->TexUvRoundCornersFill[radius], col, rounding_corners, true);
+                return;
+            }
+        }
         PathRect(p_min, p_max, rounding, rounding_corners);
         PathFillConvex(col);
     }
@@ -1143,6 +1498,22 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
         return;
 
+    // Small circles with automatic segment count: 4 quads sampling the corners of a rounded square baked in the font atlas
+    const int tex_radius = (num_segments <= 0) ? GetRoundCornersTexRadius(radius) : 0;
+    if ((Flags & ImDrawListFlags_AntiAliasedFill) && (Flags & ImDrawListFlags_RoundCornersUseTex) && _Data->TexUvRoundCornersFill != NULL && tex_radius > 0)
+    {
+        const ImVec4& uvs = _Data->TexUvRoundCornersFill[tex_radius];
+        const float quarter_uv_w = (uvs.z - uvs.x) * (radius + 1.0f) / (radius * 2.0f + 4.0f);
+        const float quarter_uv_h = (uvs.w - uvs.y) * (radius + 1.0f) / (radius * 2.0f + 4.0f);
+        const ImVec2 p_min(center.x - radius - 1.0f, center.y - radius - 1.0f), p_max(center.x + radius + 1.0f, center.y + radius + 1.0f);
+        PrimReserve(6 * 4, 4 * 4);
+        PrimRectUV(p_min, center, ImVec2(uvs.x, uvs.y), ImVec2(uvs.x + quarter_uv_w, uvs.y + quarter_uv_h), col);
+        PrimRectUV(ImVec2(center.x, p_min.y), ImVec2(p_max.x, center.y), ImVec2(uvs.z - quarter_uv_w, uvs.y), ImVec2(uvs.z, uvs.y + quarter_uv_h), col);
+        PrimRectUV(ImVec2(p_min.x, center.y), ImVec2(center.x, p_max.y), ImVec2(uvs.x, uvs.w - quarter_uv_h), ImVec2(uvs.x + quarter_uv_w, uvs.w), col);
+        PrimRectUV(center, p_max, ImVec2(uvs.z - quarter_uv_w, uvs.w - quarter_uv_h), ImVec2(uvs.z, uvs.w), col);
+        return;
+    }
+
     // Obtain segment count
     if (num_segments <= 0)
     {
@@ -1317,6 +1688,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_DrawLists);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
@@ -1544,6 +1916,8 @@ ImFontConfig::ImFontConfig()
 const int FONT_ATLAS_DEFAULT_TEX_DATA_W_HALF = 108;
 const int FONT_ATLAS_DEFAULT_TEX_DATA_H      = 27;
 const unsigned int FONT_ATLAS_DEFAULT_TEX_DATA_ID = 0x80000000;
+const unsigned int FONT_ATLAS_DEFAULT_TEX_LINES_ID = 0x80000001;
+const unsigned int FONT_ATLAS_DEFAULT_TEX_ROUND_CORNERS_ID = 0x80000002;
 static const char FONT_ATLAS_DEFAULT_TEX_DATA_PIXELS[FONT_ATLAS_DEFAULT_TEX_DATA_W_HALF * FONT_ATLAS_DEFAULT_TEX_DATA_H + 1] =
 {
     "..-         -XXXXXXX-    X    -           X           -XXXXXXX          -          XXXXXXX-     XX          "
@@ -1590,7 +1964,7 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
 
 ImFontAtlas::ImFontAtlas()
 {
-    Locked = false;
+    Locked = LockedForSharing = false;
     Flags = ImFontAtlasFlags_None;
     TexID = (ImTextureID)NULL;
     TexDesiredWidth = 0;
@@ -1603,10 +1977,14 @@ ImFontAtlas::ImFontAtlas()
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     for (int n = 0; n < IM_ARRAYSIZE(CustomRectIds); n++)
         CustomRectIds[n] = -1;
+    RefCount = 0;
 }
 
 ImFontAtlas::~ImFontAtlas()
 {
+    IM_ASSERT(RefCount == 0 && "Cannot destroy a shared ImFontAtlas still used by a context!");
+    if (LockedForSharing)
+        Locked = LockedForSharing = false;
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     Clear();
 }
@@ -1662,6 +2040,7 @@ void    ImFontAtlas::Clear()
 
 void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
     // Build atlas on demand
     if (TexPixelsAlpha8 == NULL)
     {
@@ -1678,10 +2057,12 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
 
 void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
     // Convert to RGBA32 format on demand
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
     {
+        IM_ASSERT(!LockedForSharing && "Call GetTexDataAsRGBA32() before LockForSharing() if you need RGBA32 data!");
         unsigned char* pixels = NULL;
         GetTexDataAsAlpha8(&pixels, NULL, NULL);
         if (pixels)
@@ -1702,6 +2083,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
@@ -1771,6 +2153,7 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     size_t data_size = 0;
     void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
@@ -1806,6 +2189,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* ttf_data, int ttf_size, float si
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char *)IM_ALLOC(buf_decompressed_size);
     stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
@@ -1818,6 +2202,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_d
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed_ttf_data_base85, float size_pixels, const ImFontConfig* font_cfg, const ImWchar* glyph_ranges)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
     int compressed_ttf_size = (((int)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
     void* compressed_ttf = IM_ALLOC((size_t)compressed_ttf_size);
     Decode85((const unsigned char*)compressed_ttf_data_base85, (unsigned char*)compressed_ttf);
@@ -1828,6 +2213,8 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
 
 int ImFontAtlas::AddCustomRectRegular(unsigned int id, int width, int height)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
+    IM_ASSERT(!LockedForSharing && "Cannot modify an ImFontAtlas locked for sharing!");
     // Breaking change on 2019/11/21 (1.74): ImFontAtlas::AddCustomRectRegular() now requires an ID >= 0x110000 (instead of >= 0x10000)
     IM_ASSERT(id >= 0x110000);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
@@ -1842,6 +2229,8 @@ int ImFontAtlas::AddCustomRectRegular(unsigned int id, int width, int height)
 
 int ImFontAtlas::AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int height, float advance_x, const ImVec2& offset)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
+    IM_ASSERT(!LockedForSharing && "Cannot modify an ImFontAtlas locked for sharing!");
     IM_ASSERT(font != NULL);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
@@ -1888,10 +2277,30 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 
 bool    ImFontAtlas::Build()
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     return ImFontAtlasBuildWithStbTruetype(this);
 }
 
+bool    ImFontAtlas::LockForSharing()
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (!IsBuilt())
+    {
+        if (ConfigData.empty())
+            AddFontDefault();
+        if (!Build())
+            return false;
+    }
+
+    // Fonts modified after Build() (e.g. with AddGlyph()) need their lookup tables rebuilt now, as they can't be modified once shared
+    for (int i = 0; i < Fonts.Size; i++)
+        if (Fonts[i]->DirtyLookupTables)
+            Fonts[i]->BuildLookupTable();
+    Locked = LockedForSharing = true;
+    return true;
+}
+
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
 {
     for (unsigned int i = 0; i < 256; i++)
@@ -2205,12 +2614,25 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 // Register default custom rectangles (this is called/shared by both the stb_truetype and the FreeType builder)
 void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 {
-    if (atlas->CustomRectIds[0] >= 0)
-        return;
-    if (!(atlas->Flags & ImFontAtlasFlags_NoMouseCursors))
-        atlas->CustomRectIds[0] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_DATA_ID, FONT_ATLAS_DEFAULT_TEX_DATA_W_HALF*2+1, FONT_ATLAS_DEFAULT_TEX_DATA_H);
-    else
-        atlas->CustomRectIds[0] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_DATA_ID, 2, 2);
+    // Mouse cursors or white pixels
+    if (atlas->CustomRectIds[0] < 0)
+    {
+        if (!(atlas->Flags & ImFontAtlasFlags_NoMouseCursors))
+            atlas->CustomRectIds[0] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_DATA_ID, FONT_ATLAS_DEFAULT_TEX_DATA_W_HALF*2+1, FONT_ATLAS_DEFAULT_TEX_DATA_H);
+        else
+            atlas->CustomRectIds[0] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_DATA_ID, 2, 2);
+    }
+
+    // Anti-aliased lines: one row per width, +2 columns for the transparent texel on each side, +1 row for the unused zero width
+    if (atlas->CustomRectIds[1] < 0 && !(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
+        atlas->CustomRectIds[1] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_LINES_ID, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
+
+    // Rounded corners: a row of rounded squares of size (2r+4) for fills, above a row of rings of size (2r+3) for 1 pixel outlines, r = 1..IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX
+    if (atlas->CustomRectIds[2] < 0 && !(atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+    {
+        const int r_max = IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX;
+        atlas->CustomRectIds[2] = atlas->AddCustomRectRegular(FONT_ATLAS_DEFAULT_TEX_ROUND_CORNERS_ID, r_max * (r_max + 1) + 4 * r_max, (2 * r_max + 4) + (2 * r_max + 3));
+    }
 }
 
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
@@ -2285,10 +2707,88 @@ static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas)
     atlas->TexUvWhitePixel = ImVec2((r.X + 0.5f) * atlas->TexUvScale.x, (r.Y + 0.5f) * atlas->TexUvScale.y);
 }
 
+// Row N holds a line of width N: N opaque texels centered between transparent texels. A quad spanning the row from the
+// transparent texel on the left to the one on the right, 1 texel per pixel, is an anti-aliased line with bilinear filtering.
+static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
+{
+    if (atlas->CustomRectIds[1] < 0)
+        return;
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL);
+    ImFontAtlasCustomRect& r = atlas->CustomRects[atlas->CustomRectIds[1]];
+    IM_ASSERT(r.ID == FONT_ATLAS_DEFAULT_TEX_LINES_ID);
+    IM_ASSERT(r.IsPacked());
+
+    const int w = atlas->TexWidth;
+    for (int n = 0; n < IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1; n++)
+    {
+        const int y = n;
+        const int line_width = n;
+        const int pad_left = (r.Width - line_width) / 2;
+        const int pad_right = r.Width - (pad_left + line_width);
+        IM_ASSERT(pad_left + line_width + pad_right == r.Width && y < r.Height);
+        unsigned char* write_ptr = &atlas->TexPixelsAlpha8[r.X + ((r.Y + y) * w)];
+        memset(write_ptr, 0x00, (size_t)pad_left);
+        memset(write_ptr + pad_left, 0xFF, (size_t)line_width);
+        memset(write_ptr + pad_left + line_width, 0x00, (size_t)pad_right);
+
+        // Sample the middle of the row vertically, so that bilinear filtering doesn't bleed into the neighboring rows
+        const float u0 = (float)(r.X + pad_left - 1) * atlas->TexUvScale.x;
+        const float u1 = (float)(r.X + pad_left + line_width + 1) * atlas->TexUvScale.x;
+        const float v = ((float)(r.Y + y) + 0.5f) * atlas->TexUvScale.y;
+        atlas->TexUvLines[n] = ImVec4(u0, v, u1, v);
+    }
+}
+
+// Rounded squares and rings, with anti-aliasing matching the fringe of AA fills/strokes (coverage decreasing linearly over 1 pixel across the edge):
+// - Filled square of (2r+2) texels with corners of radius r, in a box of (2r+4) texels. Corners are centered on texel corners, the 2 middle
+//   rows/columns of texels are straight edges. Circles use the 4 corners of the box.
+// - Ring of radius r and thickness 1 in a box of (2r+3) texels, centered on the middle texel. The middle row/column of texels are straight edges.
+// The outer row/column of both boxes is transparent. Rounded rectangles use them 9-slice style: each corner maps to a quarter of the box,
+// edges stretch the middle row/column of texels.
+static void ImFontAtlasBuildRenderRoundCornersTexData(ImFontAtlas* atlas)
+{
+    if (atlas->CustomRectIds[2] < 0)
+        return;
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL);
+    ImFontAtlasCustomRect& r = atlas->CustomRects[atlas->CustomRectIds[2]];
+    IM_ASSERT(r.ID == FONT_ATLAS_DEFAULT_TEX_ROUND_CORNERS_ID);
+    IM_ASSERT(r.IsPacked());
+
+    const int w = atlas->TexWidth;
+    const int rings_y = 2 * IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 4;
+    int fill_x = 0, ring_x = 0;
+    for (int radius = 1; radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX; radius++)
+    {
+        const int fill_size = 2 * radius + 4;
+        const int ring_size = 2 * radius + 3;
+        IM_ASSERT(fill_x + fill_size <= r.Width && ring_x + ring_size <= r.Width && rings_y + ring_size <= r.Height);
+        const float fill_center_min = (float)radius + 1.0f, fill_center_max = (float)radius + 3.0f;
+        const float ring_center = (float)radius + 1.5f;
+        for (int y = 0; y < fill_size; y++)
+            for (int x = 0; x < fill_size; x++)
+            {
+                const ImVec2 p((float)x + 0.5f, (float)y + 0.5f);
+                const float fill_d = ImSqrt(ImLengthSqr(ImVec2(p.x - ImClamp(p.x, fill_center_min, fill_center_max), p.y - ImClamp(p.y, fill_center_min, fill_center_max))));
+                atlas->TexPixelsAlpha8[(r.X + fill_x + x) + (r.Y + y) * w] = (unsigned char)IM_F32_TO_INT8_SAT((float)radius + 0.5f - fill_d);
+                if (x < ring_size && y < ring_size)
+                {
+                    const float ring_d = ImSqrt(ImLengthSqr(ImVec2(p.x - ring_center, p.y - ring_center)));
+                    atlas->TexPixelsAlpha8[(r.X + ring_x + x) + (r.Y + rings_y + y) * w] = (unsigned char)IM_F32_TO_INT8_SAT(1.0f - ImFabs(ring_d - (float)radius));
+                }
+            }
+        atlas->TexUvRoundCornersFill[radius] = ImVec4((float)(r.X + fill_x) * atlas->TexUvScale.x, (float)r.Y * atlas->TexUvScale.y, (float)(r.X + fill_x + fill_size) * atlas->TexUvScale.x, (float)(r.Y + fill_size) * atlas->TexUvScale.y);
+        atlas->TexUvRoundCornersStroke[radius] = ImVec4((float)(r.X + ring_x) * atlas->TexUvScale.x, (float)(r.Y + rings_y) * atlas->TexUvScale.y, (float)(r.X + ring_x + ring_size) * atlas->TexUvScale.x, (float)(r.Y + rings_y + ring_size) * atlas->TexUvScale.y);
+        fill_x += fill_size;
+        ring_x += ring_size;
+    }
+}
+
 void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
 {
-    // Render into our custom data block
+    // Render into our custom data blocks
     ImFontAtlasBuildRenderDefaultTexData(atlas);
+    ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildRenderRoundCornersTexData(atlas);
 
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
@@ -2626,6 +3126,8 @@ void    ImFont::ClearOutputData()
 
 void ImFont::BuildLookupTable()
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
+    IM_ASSERT((ContainerAtlas == NULL || !ContainerAtlas->LockedForSharing) && "Cannot modify a font from an ImFontAtlas locked for sharing!");
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -2689,18 +3191,22 @@ bool ImFont::IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last)
 
 void ImFont::SetGlyphVisible(ImWchar c, bool visible)
 {
+    IM_ASSERT((ContainerAtlas == NULL || !ContainerAtlas->LockedForSharing) && "Cannot modify a font from an ImFontAtlas locked for sharing!");
     if (ImFontGlyph* glyph = (ImFontGlyph*)(void*)FindGlyph((ImWchar)c))
         glyph->Visible = visible ? 1 : 0;
 }
 
 void ImFont::SetFallbackChar(ImWchar c)
 {
+    IM_ASSERT((ContainerAtlas == NULL || !ContainerAtlas->LockedForSharing) && "Cannot modify a font from an ImFontAtlas locked for sharing!");
     FallbackChar = c;
     BuildLookupTable();
 }
 
 void ImFont::GrowIndex(int new_size)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
+    IM_ASSERT((ContainerAtlas == NULL || !ContainerAtlas->LockedForSharing) && "Cannot modify a font from an ImFontAtlas locked for sharing!");
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
     if (new_size <= IndexLookup.Size)
         return;
@@ -2712,6 +3218,8 @@ void ImFont::GrowIndex(int new_size)
 // Not to be mistaken with texture coordinates, which are held by u0/v0/u1/v1 in normalized format (0.0..1.0 on each texture axis).
 void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
+    IM_ASSERT((ContainerAtlas == NULL || !ContainerAtlas->LockedForSharing) && "Cannot modify a font from an ImFontAtlas locked for sharing!");
     Glyphs.resize(Glyphs.Size + 1);
     ImFontGlyph& glyph = Glyphs.back();
     glyph.Codepoint = (unsigned int)codepoint;
@@ -2736,6 +3244,8 @@ void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1,
 
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
+    IMGUI_MEMALLOC_TAG_SCOPE(ImGuiMemAllocTag_Fonts);
+    IM_ASSERT((ContainerAtlas == NULL || !ContainerAtlas->LockedForSharing) && "Cannot modify a font from an ImFontAtlas locked for sharing!");
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
     unsigned int index_size = (unsigned int)IndexLookup.Size;
 
@@ -3381,9 +3891,9 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
+static IMGUI_THREAD_LOCAL unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
+static IMGUI_THREAD_LOCAL const unsigned char *stb__barrier_in_b;
+static IMGUI_THREAD_LOCAL unsigned char *stb__dout;
 static void stb__match(const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
@@ -83,19 +83,26 @@ struct ImGuiColumns;                // Storage data for a columns set
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
+struct ImGuiHashStorage;            // Open-addressing alternative to ImGuiStorage for large key sets
+struct ImGuiIDLiteral;              // String literal with its hash precomputed at compile-time
+struct ImGuiInputRecorder;          // Storage for input recording and replay (see StartInputRecording())
+struct ImGuiInputRecordState;       // Inputs of one recorded frame
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiItemHoveredDataBackup;  // Backup and restore IsItemHovered() internal data
+struct ImGuiMemoryBudgetStats;      // Memory reclaimed to honor io.ConfigMemoryBudget
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavMoveResult;          // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfiler;               // Storage for the profiler hooks and the built-in frame recorder (IMGUI_ENABLE_PROFILER)
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
+struct ImGuiWindowDrawCache;        // Copy of a window draw list, reused while its content hash doesn't change (see SetNextWindowContentHash())
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
@@ -137,8 +144,21 @@ namespace ImStb
 // Context pointer
 //-----------------------------------------------------------------------------
 
+// With IMGUI_USE_THREAD_LOCAL_CONTEXT, the current context pointer (and a few other globals) are stored in thread local storage.
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#if (__cplusplus >= 201100) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define IMGUI_THREAD_LOCAL              thread_local
+#elif defined(_MSC_VER)
+#define IMGUI_THREAD_LOCAL              __declspec(thread)
+#else
+#define IMGUI_THREAD_LOCAL              __thread
+#endif
+#else
+#define IMGUI_THREAD_LOCAL
+#endif
+
 #ifndef GImGui
-extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
+extern IMGUI_API IMGUI_THREAD_LOCAL ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
 
 //-----------------------------------------------------------------------------
@@ -206,18 +226,64 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helpers: Geometry
 // - Helpers: Bit arrays
 // - Helper: ImBitVector
+// - Helper: ImGuiHashStorage
+// - Helper: ImSmallVector<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImLinearArena
+// - Helper: ImSlabAllocator
 //-----------------------------------------------------------------------------
 
 // Helpers: Misc
 #define ImQsort         qsort
 IMGUI_API ImU32         ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImU32         ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+IMGUI_API ImU32         ImHashStrCombine(ImU32 seed, const ImGuiIDLiteral& label);  // == ImHashStr(label.Str, 0, seed), O(1) when label was built with IM_ID_LITERAL()
+IMGUI_API int           ImAtomicAdd(int* p, int v);                                 // Atomically add 'v' to '*p', return the new value. Used for reference counts of data shared across threads.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImU32     ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
 
+// Helpers: Compile-time hashing of string literals
+// - CRC is linear: ImHashStr(str, 0, seed) == ImHashStr(str, 0, 0) ^ (seed * x^(8*len) mod P), 'len' being the length of the hashed tail (after the last ###).
+//   We can compute both terms of a string literal at compile-time and only do a carry-less multiply at runtime to combine them with the ID stack seed.
+// - IM_ID_LITERAL("label") builds a ImGuiIDLiteral. Without C++11 constexpr support, the hash is computed at runtime instead (same value, no speed-up).
+// - Use window->GetID(IM_ID_LITERAL("label")) explicitly where the hash matters. ImGuiWindow::GetID(const char*) doesn't try to detect literals, to keep the common path free of extra checks.
+// - Widgets taking a label opt in with IM_LABEL_LITERAL("label"), e.g. ImGui::Button(IM_LABEL_LITERAL("OK")): see SetNextItemLabelLiteral() and GetItemLabelID().
+struct ImGuiIDLiteral
+{
+    const char*     Str;            // Zero-terminated string literal
+    ImU32           Hash;           // == ImHashStr(Str, 0, 0)
+    ImU32           ShiftK;         // == x^(8*len-1) mod P in CRC bit order, or 0 to hash Str at runtime (not computed, or too short to benefit)
+    ImGuiIDLiteral()                                            { Str = NULL; Hash = ShiftK = 0; }
+    ImGuiIDLiteral(const char* str, ImU32 hash, ImU32 shift_k) { Str = str; Hash = hash; ShiftK = shift_k; }
+};
+#if (__cplusplus >= 201100) || (defined(_MSC_VER) && _MSC_VER >= 1910)
+#ifdef IMGUI_USE_CRC32C_HASH
+#define IM_HASH_CRC_POLY                0x82F63B78u
+#else
+#define IM_HASH_CRC_POLY                0xEDB88320u
+#endif
+#ifdef __PCLMUL__
+#define IM_HASH_LITERAL_MIN_LEN         1       // Below this length, hashing the string at runtime is faster than combining (portable carry-less multiply is ~16 integer multiplies)
+#else
+#define IM_HASH_LITERAL_MIN_LEN         8
+#endif
+template<ImU32 V> struct ImHashConstValue { static const ImU32 Value = V; }; // Force compile-time evaluation
+constexpr ImU32         ImHashConstBit(ImU32 crc)               { return (crc >> 1) ^ ((crc & 1) ? IM_HASH_CRC_POLY : 0u); }
+constexpr ImU32         ImHashConstByte(ImU32 crc)              { return ImHashConstBit(ImHashConstBit(ImHashConstBit(ImHashConstBit(ImHashConstBit(ImHashConstBit(ImHashConstBit(ImHashConstBit(crc)))))))); }
+constexpr bool          ImHashConstIsReset(const char* s)       { return s[0] == '#' && s[1] == '#' && s[2] == '#'; }
+constexpr ImU32         ImHashStrConstEx(const char* s, ImU32 seed_crc, ImU32 crc) { return (*s == 0) ? ~crc : ImHashStrConstEx(s + 1, seed_crc, ImHashConstByte((ImHashConstIsReset(s) ? seed_crc : crc) ^ (unsigned char)*s)); }
+constexpr int           ImHashStrConstTailLen(const char* s, int len) { return (*s == 0) ? len : ImHashStrConstTailLen(s + 1, ImHashConstIsReset(s) ? 1 : len + 1); }
+constexpr ImU32         ImHashConstShift(ImU32 crc, int bytes)  { return (bytes == 0) ? crc : ImHashConstShift(ImHashConstByte(crc), bytes - 1); }
+constexpr ImU32         ImHashStrConst(const char* s, ImU32 seed = 0) { return ImHashStrConstEx(s, ~seed, ~seed); }                                   // == ImHashStr(s, 0, seed)
+constexpr ImU32         ImHashStrConstShiftK(const char* s)     { return (ImHashStrConstTailLen(s, 0) < IM_HASH_LITERAL_MIN_LEN) ? 0u : ImHashConstShift(0x80000000u >> 7, ImHashStrConstTailLen(s, 0) - 1); }
+#define IM_ID_LITERAL(_STR)             ImGuiIDLiteral(_STR, ImHashConstValue<ImHashStrConst(_STR)>::Value, ImHashConstValue<ImHashStrConstShiftK(_STR)>::Value)
+#else
+#define IM_ID_LITERAL(_STR)             ImGuiIDLiteral(_STR, 0, 0)
+#endif
+#define IM_LABEL_LITERAL(_STR)          ImGui::SetNextItemLabelLiteral(IM_ID_LITERAL(_STR))
+
 // Helpers: Color Blending
 IMGUI_API ImU32         ImAlphaBlendColors(ImU32 col_a, ImU32 col_b);
 
@@ -382,30 +448,122 @@ struct IMGUI_API ImBitVector
     void            ClearBit(int n)             { IM_ASSERT(n < (Storage.Size << 5)); ImBitArrayClearBit(Storage.Data, n); }
 };
 
+// Helper: ImGuiHashStorage
+// Open-addressing (linear probing) alternative to ImGuiStorage, exposing the same Get***/Set***/Get***Ref() functions with the same semantics.
+// Queries and insertions are O(1) regardless of the number of keys, whereas ImGuiStorage has O(Log N) queries and O(N) insertions.
+// Costs about twice the memory (load factor is kept under 50%) and pairs are not sorted. Prefer it for large or fast growing key sets.
+// As with ImGuiStorage, pointers returned by Get***Ref() are only valid until a new key is added.
+struct IMGUI_API ImGuiHashStorage
+{
+    typedef ImGuiStorage::ImGuiStoragePair ImGuiStoragePair;
+
+    ImVector<ImGuiStoragePair>  Data;           // Slots, power-of-two count. Unused slots have key == 0.
+    int                         Count;          // Number of used slots in Data
+    bool                        ZeroKeyUsed;    // Key 0 is stored out of the table, since 0 marks unused slots
+    ImGuiStoragePair            ZeroKeyPair;
+
+    ImGuiHashStorage() : ZeroKeyPair(0, (void*)NULL) { Count = 0; ZeroKeyUsed = false; }
+    void                Clear()                 { Data.clear(); Count = 0; ZeroKeyUsed = false; }
+    void                swap(ImGuiHashStorage& rhs) { Data.swap(rhs.Data); ImSwap(Count, rhs.Count); ImSwap(ZeroKeyUsed, rhs.ZeroKeyUsed); ImSwap(ZeroKeyPair, rhs.ZeroKeyPair); }
+    int                 GetSize() const         { return Count + (ZeroKeyUsed ? 1 : 0); }
+    void                Reserve(int key_count);
+    int                 GetInt(ImGuiID key, int default_val = 0) const      { const ImGuiStoragePair* it = FindPair(key); return it ? it->val_i : default_val; }
+    void                SetInt(ImGuiID key, int val)                        { *GetIntRef(key) = val; }
+    bool                GetBool(ImGuiID key, bool default_val = false) const{ return GetInt(key, default_val ? 1 : 0) != 0; }
+    void                SetBool(ImGuiID key, bool val)                      { SetInt(key, val ? 1 : 0); }
+    float               GetFloat(ImGuiID key, float default_val = 0.0f) const { const ImGuiStoragePair* it = FindPair(key); return it ? it->val_f : default_val; }
+    void                SetFloat(ImGuiID key, float val)                    { *GetFloatRef(key) = val; }
+    void*               GetVoidPtr(ImGuiID key) const                       { const ImGuiStoragePair* it = FindPair(key); return it ? it->val_p : NULL; }
+    void                SetVoidPtr(ImGuiID key, void* val)                  { *GetVoidPtrRef(key) = val; }
+    int*                GetIntRef(ImGuiID key, int default_val = 0)         { bool added; ImGuiStoragePair* it = FindOrAddPair(key, &added); if (added) it->val_i = default_val; return &it->val_i; }
+    bool*               GetBoolRef(ImGuiID key, bool default_val = false)   { return (bool*)GetIntRef(key, default_val ? 1 : 0); }
+    float*              GetFloatRef(ImGuiID key, float default_val = 0.0f)  { bool added; ImGuiStoragePair* it = FindOrAddPair(key, &added); if (added) it->val_f = default_val; return &it->val_f; }
+    void**              GetVoidPtrRef(ImGuiID key, void* default_val = NULL){ bool added; ImGuiStoragePair* it = FindOrAddPair(key, &added); if (added) it->val_p = default_val; return &it->val_p; }
+    void                SetAllInt(int val);
+
+    // [Internal]
+    const ImGuiStoragePair* FindPair(ImGuiID key) const;
+    ImGuiStoragePair*       FindOrAddPair(ImGuiID key, bool* p_added);
+    void                    Rehash(int slot_count);
+};
+
+// Helper: ImSmallVector<>
+// ImVector<> variant storing its first N elements inline, only allocating when growing past N. Used for stacks which are generally shallow (PushID(), PushItemWidth() etc.)
+// Same fields and subset of functions as ImVector<>: Data points either to the inline storage or to a heap block. Like ImVector<>, elements must be memcpy-able.
+// As Data may point inside the instance itself, the instance itself must not be memcpy'ed/relocated (copy constructor and assignment are fine).
+template<typename T, int N>
+struct IMGUI_API ImSmallVector
+{
+    int                 Size;
+    int                 Capacity;
+    T*                  Data;
+    ImU64               InlineData[(N * sizeof(T) + sizeof(ImU64) - 1) / sizeof(ImU64)];    // Storage for the first N elements (declared as ImU64 for alignment)
+
+    inline ImSmallVector()                                          { Size = 0; Capacity = N; Data = (T*)(void*)InlineData; }
+    inline ImSmallVector(const ImSmallVector<T, N>& src)            { Size = 0; Capacity = N; Data = (T*)(void*)InlineData; operator=(src); }
+    inline ImSmallVector<T, N>& operator=(const ImSmallVector<T, N>& src) { resize(src.Size); memcpy(Data, src.Data, (size_t)Size * sizeof(T)); return *this; }
+    inline ~ImSmallVector()                                         { if (!is_inline()) IM_FREE(Data); }
+
+    inline bool         is_inline() const                           { return Data == (const T*)(const void*)InlineData; }
+    inline bool         empty() const                               { return Size == 0; }
+    inline int          size() const                                { return Size; }
+    inline int          capacity() const                            { return Capacity; }
+    inline int          heap_size_in_bytes() const                  { return is_inline() ? 0 : Capacity * (int)sizeof(T); }
+    inline T&           operator[](int i)                           { IM_ASSERT(i < Size); return Data[i]; }
+    inline const T&     operator[](int i) const                     { IM_ASSERT(i < Size); return Data[i]; }
+
+    inline void         clear()                                     { if (!is_inline()) { IM_FREE(Data); Data = (T*)(void*)InlineData; Capacity = N; } Size = 0; } // Release heap storage if any
+    inline T*           begin()                                     { return Data; }
+    inline const T*     begin() const                               { return Data; }
+    inline T*           end()                                       { return Data + Size; }
+    inline const T*     end() const                                 { return Data + Size; }
+    inline T&           front()                                     { IM_ASSERT(Size > 0); return Data[0]; }
+    inline const T&     front() const                               { IM_ASSERT(Size > 0); return Data[0]; }
+    inline T&           back()                                      { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+    inline const T&     back() const                                { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+
+    inline int          _grow_capacity(int sz) const                { int new_capacity = Capacity + Capacity / 2; return new_capacity > sz ? new_capacity : sz; }
+    inline void         resize(int new_size)                        { if (new_size > Capacity) reserve(_grow_capacity(new_size)); Size = new_size; }
+    inline void         shrink(int new_size)                        { IM_ASSERT(new_size <= Size); Size = new_size; }
+    inline void         reserve(int new_capacity)                   { if (new_capacity <= Capacity) return; T* new_data = (T*)IM_ALLOC((size_t)new_capacity * sizeof(T)); memcpy(new_data, Data, (size_t)Size * sizeof(T)); if (!is_inline()) IM_FREE(Data); Data = new_data; Capacity = new_capacity; }
+
+    // NB: It is illegal to call push_back with a reference pointing inside the vector data itself! e.g. v.push_back(v[10]) is forbidden.
+    inline void         push_back(const T& v)                       { if (Size == Capacity) reserve(_grow_capacity(Size + 1)); memcpy(&Data[Size], &v, sizeof(v)); Size++; }
+    inline void         pop_back()                                  { IM_ASSERT(Size > 0); Size--; }
+    inline bool         contains(const T& v) const                  { const T* data = Data; const T* data_end = Data + Size; while (data < data_end) if (*data++ == v) return true; return false; }
+    inline int          index_from_ptr(const T* it) const           { IM_ASSERT(it >= Data && it < Data + Size); const ptrdiff_t off = it - Data; return (int)off; }
+};
+
 // Helper: ImPool<>
-// Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
-// Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
+// Basic keyed storage for instances, O(1) indexable, O(Log N) queries by ID.
+// Instances are allocated in fixed-size blocks of BLOCK_SIZE (slabs) which are never moved or freed until Clear(): Add() doesn't invalidate pointers,
+// a pointer stays valid until its instance is removed. Removed slots are reused by following Add(). Honor constructor/destructor. Indexes have the same lifetime as the associated object.
+// The ID->Index map defaults to ImGuiStorage, use ImPool<T, ImGuiHashStorage> for pools expected to hold many instances.
 typedef int ImPoolIdx;
-template<typename T>
+static inline void ImPoolReserveMap(ImGuiStorage& map, int key_count)      { map.Data.reserve(key_count); }
+static inline void ImPoolReserveMap(ImGuiHashStorage& map, int key_count)  { map.Reserve(key_count); }
+template<typename T, typename TMap = ImGuiStorage, int BLOCK_SIZE = 8>
 struct IMGUI_API ImPool
 {
-    ImVector<T>     Buf;        // Contiguous data
-    ImGuiStorage    Map;        // ID->Index
+    ImSmallVector<T*, 4> Blocks; // Blocks of BLOCK_SIZE instances
+    ImPoolIdx       Size;       // Number of slots used (live or free)
+    TMap            Map;        // ID->Index
     ImPoolIdx       FreeIdx;    // Next free idx to use
 
-    ImPool()    { FreeIdx = 0; }
+    ImPool()    { Size = FreeIdx = 0; }
     ~ImPool()   { Clear(); }
-    T*          GetByKey(ImGuiID key)               { int idx = Map.GetInt(key, -1); return (idx != -1) ? &Buf[idx] : NULL; }
-    T*          GetByIndex(ImPoolIdx n)             { return &Buf[n]; }
-    ImPoolIdx   GetIndex(const T* p) const          { IM_ASSERT(p >= Buf.Data && p < Buf.Data + Buf.Size); return (ImPoolIdx)(p - Buf.Data); }
-    T*          GetOrAddByKey(ImGuiID key)          { int* p_idx = Map.GetIntRef(key, -1); if (*p_idx != -1) return &Buf[*p_idx]; *p_idx = FreeIdx; return Add(); }
-    bool        Contains(const T* p) const          { return (p >= Buf.Data && p < Buf.Data + Buf.Size); }
-    void        Clear()                             { for (int n = 0; n < Map.Data.Size; n++) { int idx = Map.Data[n].val_i; if (idx != -1) Buf[idx].~T(); } Map.Clear(); Buf.clear(); FreeIdx = 0; }
-    T*          Add()                               { int idx = FreeIdx; if (idx == Buf.Size) { Buf.resize(Buf.Size + 1); FreeIdx++; } else { FreeIdx = *(int*)&Buf[idx]; } IM_PLACEMENT_NEW(&Buf[idx]) T(); return &Buf[idx]; }
+    T*          GetByKey(ImGuiID key)               { int idx = Map.GetInt(key, -1); return (idx != -1) ? GetByIndex(idx) : NULL; }
+    T*          GetByIndex(ImPoolIdx n)             { IM_ASSERT(n >= 0 && n < Size); return &Blocks[(unsigned int)n / BLOCK_SIZE][(unsigned int)n % BLOCK_SIZE]; }
+    ImPoolIdx   GetIndex(const T* p) const          { for (int b = 0; b < Blocks.Size; b++) if (p >= Blocks[b] && p < Blocks[b] + BLOCK_SIZE) return (ImPoolIdx)(b * BLOCK_SIZE + (p - Blocks[b])); IM_ASSERT(0); return -1; }
+    T*          GetOrAddByKey(ImGuiID key)          { int* p_idx = Map.GetIntRef(key, -1); if (*p_idx != -1) return GetByIndex(*p_idx); *p_idx = FreeIdx; return Add(); }
+    bool        Contains(const T* p) const          { for (int b = 0; b < Blocks.Size; b++) if (p >= Blocks[b] && p < Blocks[b] + BLOCK_SIZE) return (b * BLOCK_SIZE + (p - Blocks[b])) < Size; return false; }
+    void        Clear()                             { ImBitVector freed; freed.Create(Size + 1); for (int idx = FreeIdx; idx != Size; idx = *(int*)GetByIndex(idx)) freed.SetBit(idx); for (int n = 0; n < Size; n++) if (!freed.TestBit(n)) GetByIndex(n)->~T(); for (int b = 0; b < Blocks.Size; b++) IM_FREE(Blocks[b]); Map.Clear(); Blocks.clear(); Size = FreeIdx = 0; }
+    T*          Add()                               { int idx = FreeIdx; if (idx == Size) { if (Size == Blocks.Size * BLOCK_SIZE) Blocks.push_back((T*)IM_ALLOC(sizeof(T) * BLOCK_SIZE)); Size++; FreeIdx++; } else { FreeIdx = *(int*)GetByIndex(idx); } T* p = GetByIndex(idx); IM_PLACEMENT_NEW(p) T(); return p; }
     void        Remove(ImGuiID key, const T* p)     { Remove(key, GetIndex(p)); }
-    void        Remove(ImGuiID key, ImPoolIdx idx)  { Buf[idx].~T(); *(int*)&Buf[idx] = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); }
-    void        Reserve(int capacity)               { Buf.reserve(capacity); Map.Data.reserve(capacity); }
-    int         GetSize() const                     { return Buf.Size; }
+    void        Remove(ImGuiID key, ImPoolIdx idx)  { T* p = GetByIndex(idx); p->~T(); *(int*)p = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); }
+    void        Reserve(int capacity)               { while (Blocks.Size * BLOCK_SIZE < capacity) Blocks.push_back((T*)IM_ALLOC(sizeof(T) * BLOCK_SIZE)); ImPoolReserveMap(Map, capacity); }
+    int         GetSize() const                     { return Size; }
+    int         GetCapacity() const                 { return Blocks.Size * BLOCK_SIZE; }
 };
 
 // Helper: ImChunkStream<>
@@ -430,6 +588,52 @@ struct IMGUI_API ImChunkStream
     T*      ptr_from_offset(int off)    { IM_ASSERT(off >= 4 && off < Buf.Size); return (T*)(void*)(Buf.Data + off); }
 };
 
+// Helper: ImLinearArena
+// Linear allocator for transient data: Alloc() bumps an offset into a single block and nothing is freed individually, Reset() releases everything at once.
+// Allocations which don't fit in the block are made on the heap until the next Reset(), which then grows the block to fit them,
+// so once warmed up Alloc() never hits the heap. Reset() shrinks the block back when its peak usage over the last frames was much lower.
+// Allocations larger than 1 MB always go to the heap. Allocations are aligned on 16 bytes. No constructor/destructor are called.
+struct IMGUI_API ImLinearArena
+{
+    char*           Block;
+    int             BlockSize;          // Bytes used in Block
+    int             BlockCapacity;
+    int             TotalSize;          // Bytes allocated since the last Reset(), including overflow allocations (but not the ones too large for Block)
+    int             PeakSize;           // Highest TotalSize over the last Reset() calls, to decide when to shrink Block
+    int             PeakResetsCount;    // Number of Reset() calls accounted in PeakSize
+    ImVector<void*> OverflowAllocs;     // Heap allocations made since the last Reset() because Block was full or they were too large
+
+    ImLinearArena()     { Block = NULL; BlockSize = BlockCapacity = TotalSize = PeakSize = PeakResetsCount = 0; }
+    ~ImLinearArena()    { Clear(); }
+    void*               Alloc(size_t size);
+    template<typename T>
+    T*                  AllocArray(int count)   { return (T*)Alloc((size_t)count * sizeof(T)); }
+    void                Reset();
+    void                Clear();
+};
+
+// Helper: ImSlabAllocator
+// Fixed-size allocator for objects which are created in large numbers (windows): objects are carved out of slabs of ItemsPerSlab items,
+// so creating thousands of objects doesn't fragment the heap. Freed items are reused by following Alloc(). Addresses are stable.
+// Slabs are only released by Clear(). No constructor/destructor are called: use IM_PLACEMENT_NEW() and call the destructor explicitly. Call Init() before use.
+struct IMGUI_API ImSlabAllocator
+{
+    int             ItemSize;           // Aligned on 16 bytes
+    int             ItemsPerSlab;
+    int             ItemsCount;         // Items currently allocated
+    int             SlabUsed;           // Items carved out of the last slab
+    ImVector<void*> Slabs;
+    void*           FreeList;           // Freed items, linked through their first bytes
+
+    ImSlabAllocator()   { ItemSize = ItemsPerSlab = ItemsCount = SlabUsed = 0; FreeList = NULL; }
+    ~ImSlabAllocator()  { Clear(); }
+    void                Init(size_t item_size, int items_per_slab)  { IM_ASSERT(ItemsCount == 0 && item_size >= sizeof(void*)); ItemSize = (int)((item_size + 15) & ~(size_t)15); ItemsPerSlab = items_per_slab; }
+    void*               Alloc();
+    void                Free(void* ptr);
+    void                Clear();
+    int                 GetAllocatedBytes() const   { return Slabs.Size * ItemsPerSlab * ItemSize; }
+};
+
 //-----------------------------------------------------------------------------
 // Misc data structures
 //-----------------------------------------------------------------------------
@@ -898,9 +1102,14 @@ struct ImGuiColumns
 
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
+// Draw lists only read from it, so an instance may be used by draw lists on multiple threads as long as nobody modifies it meanwhile.
+// The context's main instance is modified during the frame (e.g. current font), detached draw lists use a copy which is only updated by NewFrame().
 struct IMGUI_API ImDrawListSharedData
 {
     ImVec2          TexUvWhitePixel;            // UV of white pixel in the atlas
+    const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas (NULL if not baked)
+    const ImVec4*   TexUvRoundCornersFill;      // UV of anti-aliased discs in the atlas (NULL if not baked)
+    const ImVec4*   TexUvRoundCornersStroke;    // UV of anti-aliased 1 pixel rings in the atlas (NULL if not baked)
     ImFont*         Font;                       // Current/default font (optional, for simplified AddText overload)
     float           FontSize;                   // Current/default font size (optional, for simplified AddText overload)
     float           CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo()
@@ -948,7 +1157,8 @@ enum ImGuiNextWindowDataFlags_
     ImGuiNextWindowDataFlags_HasCollapsed       = 1 << 3,
     ImGuiNextWindowDataFlags_HasSizeConstraint  = 1 << 4,
     ImGuiNextWindowDataFlags_HasFocus           = 1 << 5,
-    ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6
+    ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6,
+    ImGuiNextWindowDataFlags_HasContentHash     = 1 << 7
 };
 
 // Storage for SetNexWindow** functions
@@ -967,6 +1177,7 @@ struct ImGuiNextWindowData
     ImGuiSizeCallback           SizeCallback;
     void*                       SizeCallbackUserData;
     float                       BgAlphaVal;             // Override background alpha
+    ImGuiID                     ContentHashVal;         // Content hash for draw list reuse (see SetNextWindowContentHash())
     ImVec2                      MenuBarOffsetMinVal;    // *Always on* This is not exposed publicly, so we don't clear it.
 
     ImGuiNextWindowData()       { memset(this, 0, sizeof(*this)); }
@@ -977,7 +1188,8 @@ enum ImGuiNextItemDataFlags_
 {
     ImGuiNextItemDataFlags_None     = 0,
     ImGuiNextItemDataFlags_HasWidth = 1 << 0,
-    ImGuiNextItemDataFlags_HasOpen  = 1 << 1
+    ImGuiNextItemDataFlags_HasOpen  = 1 << 1,
+    ImGuiNextItemDataFlags_HasLabelLiteral = 1 << 2
 };
 
 struct ImGuiNextItemData
@@ -987,6 +1199,7 @@ struct ImGuiNextItemData
     ImGuiID                     FocusScopeId;   // Set by SetNextItemMultiSelectData() (!= 0 signify value has been set, so it's an alternate version of HasSelectionData, we don't use Flags for this because they are cleared too early. This is mostly used for debugging)
     ImGuiCond                   OpenCond;
     bool                        OpenVal;        // Set by SetNextItemOpen()
+    ImGuiIDLiteral              LabelLiteral;   // Set by SetNextItemLabelLiteral()
 
     ImGuiNextItemData()         { memset(this, 0, sizeof(*this)); }
     inline void ClearFlags()    { Flags = ImGuiNextItemDataFlags_None; } // Also cleared manually by ItemAdd()!
@@ -1011,6 +1224,100 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)          { Ptr = NULL; Index = index; }
 };
 
+// Memory reclaimed to honor io.ConfigMemoryBudget since the context was created, in bytes (see Metrics window)
+struct ImGuiMemoryBudgetStats
+{
+    int                     CompactedWindows;   // Number of window compactions
+    int                     DrawLists;          // Window draw lists, draw caches and their splitter channels
+    int                     Columns;            // Columns data and their splitter channels
+    int                     Storage;            // Unused capacity of window state storage
+    int                     TabBars;            // Unused capacity of tab bars not visible last frame
+    int                     InputText;          // Buffers of the inactive InputText() state
+    int                     StorageEntries;     // Number of StateStorage entries removed (see io.ConfigWindowsStorageGcFrames)
+    int                     LastFrame;          // Frame of the last compaction, or -1
+
+    ImGuiMemoryBudgetStats() { memset(this, 0, sizeof(*this)); LastFrame = -1; }
+    int                     GetTotal() const    { return DrawLists + Columns + Storage + TabBars + InputText; }
+};
+
+// Inputs of one frame, as recorded/replayed by NewFrame() (see StartInputRecording())
+struct ImGuiInputRecordState
+{
+    ImVec2                  DisplaySize;
+    float                   DeltaTime;
+    ImVec2                  MousePos;
+    bool                    MouseDown[5];
+    float                   MouseWheel;
+    float                   MouseWheelH;
+    bool                    KeyCtrl, KeyShift, KeyAlt, KeySuper;
+    bool                    KeysDown[512];
+    float                   NavInputs[ImGuiNavInput_COUNT];
+
+    ImGuiInputRecordState() { memset(this, 0, sizeof(*this)); }
+};
+
+// Storage for input recording and replay. Data holds a header followed by frames, each encoded as a delta from the previous one.
+struct ImGuiInputRecorder
+{
+    bool                    Recording;
+    bool                    Replaying;
+    ImVector<char>          Data;
+    int                     FramesCount;
+    int                     ReplayFrame;        // Index of the next frame to replay
+    int                     ReplayOffset;       // Offset of the next frame to replay in Data[]
+    ImGuiInputRecordState   State;              // Last recorded/replayed frame
+
+    ImGuiInputRecorder()    { Recording = Replaying = false; FramesCount = ReplayFrame = ReplayOffset = 0; }
+};
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+// Scope recorded by the built-in profiler (see SetProfilerRecordFrames()). Times are in nanoseconds.
+struct ImGuiProfilerEvent
+{
+    const char*             Name;               // Static string passed to ProfilerBeginScope()
+    int                     DetailOffset;       // Offset into ImGuiProfilerFrame::Strings, or -1
+    int                     Depth;
+    ImU64                   TimeBegin;
+    ImU64                   TimeEnd;            // 0 while the scope is still open
+};
+
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;
+    ImU64                   TimeBegin;
+    ImVector<ImGuiProfilerEvent> Events;
+    ImGuiTextBuffer         Strings;            // Copies of the zero-terminated detail strings (e.g. window names)
+
+    ImGuiProfilerFrame()    { FrameCount = -1; TimeBegin = 0; }
+    const char*             GetDetail(const ImGuiProfilerEvent& ev) const { return ev.DetailOffset >= 0 ? Strings.begin() + ev.DetailOffset : NULL; }
+};
+
+struct ImGuiProfilerStackEntry
+{
+    const char*             Name;
+    const char*             Detail;
+    int                     FrameCount;         // Frame the event was recorded into, or -1 when not recording
+    int                     EventIndex;
+};
+
+// Storage for the profiler hooks (see IMGUI_PROFILER_SCOPE() and ImGui::SetProfilerCallbacks())
+struct ImGuiProfiler
+{
+    ImGuiProfilerScopeCallback  BeginFn;
+    ImGuiProfilerScopeCallback  EndFn;
+    void*                       UserData;
+    ImVector<ImGuiProfilerFrame*> Frames;       // Ring buffer of recorded frames
+    int                         FramesHead;     // Index of the frame being recorded into Frames[]
+    int                         FramesCount;    // Number of valid frames in Frames[]
+    ImVector<ImGuiProfilerStackEntry> Stack;    // Currently open scopes
+    ImGuiTextBuffer             TraceData;      // Output of SaveProfilerTraceToMemory()
+
+    ImGuiProfiler()         { BeginFn = EndFn = NULL; UserData = NULL; FramesHead = -1; FramesCount = 0; }
+};
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // Main Dear ImGui context
 //-----------------------------------------------------------------------------
@@ -1019,12 +1326,18 @@ struct ImGuiContext
 {
     bool                    Initialized;
     bool                    FontAtlasOwnedByContext;            // IO.Fonts-> is owned by the ImGuiContext and will be destructed along with it.
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    void*                 (*MemAllocFunc)(size_t sz, void* user_data);  // Allocator functions captured by CreateContext() from the creating thread. Used by MemAlloc()/MemFree() while this context is current.
+    void                  (*MemFreeFunc)(void* ptr, void* user_data);
+    void*                   MemAllocatorUserData;
+#endif
     ImGuiIO                 IO;
     ImGuiStyle              Style;
     ImFont*                 Font;                               // (Shortcut) == FontStack.empty() ? IO.Font : FontStack.back()
     float                   FontSize;                           // (Shortcut) == FontBaseSize * g.CurrentWindow->FontWindowScale == window->FontSize(). Text height for current window.
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     ImDrawListSharedData    DrawListSharedData;
+    ImDrawListSharedData    DrawListSharedDataDetached;         // Copy of DrawListSharedData made by NewFrame() and constant for the frame, used by detached draw lists which may be filled from other threads (see SetupDetachedDrawList())
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -1035,10 +1348,11 @@ struct ImGuiContext
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
+    ImSlabAllocator         WindowsAllocator;                   // Storage for ImGuiWindow instances (including their ImDrawList)
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Windows, sorted in focus order, back to front. (FIXME: We could only store root windows here! Need to sort out the Docking equivalent which is RootWindowDockStop and is unfortunately a little more dynamic)
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindow*>  CurrentWindowStack;
-    ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
+    ImGuiHashStorage        WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Will catch mouse inputs
@@ -1081,9 +1395,9 @@ struct ImGuiContext
     ImGuiNextItemData       NextItemData;                       // Storage for SetNextItem** functions
 
     // Shared stacks
-    ImVector<ImGuiColorMod> ColorModifiers;                     // Stack for PushStyleColor()/PopStyleColor()
-    ImVector<ImGuiStyleMod> StyleModifiers;                     // Stack for PushStyleVar()/PopStyleVar()
-    ImVector<ImFont*>       FontStack;                          // Stack for PushFont()/PopFont()
+    ImSmallVector<ImGuiColorMod, 8> ColorModifiers;             // Stack for PushStyleColor()/PopStyleColor()
+    ImSmallVector<ImGuiStyleMod, 8> StyleModifiers;             // Stack for PushStyleVar()/PopStyleVar()
+    ImSmallVector<ImFont*, 4> FontStack;                        // Stack for PushFont()/PopFont()
     ImVector<ImGuiPopupData>OpenPopupStack;                     // Which popups are open (persistent)
     ImVector<ImGuiPopupData>BeginPopupStack;                    // Which level of BeginPopup() we are in (reset every frame)
 
@@ -1145,6 +1459,7 @@ struct ImGuiContext
     // Render
     ImDrawData              DrawData;                           // Main ImDrawData instance to pass render information to the user
     ImDrawDataBuilder       DrawDataBuilder;
+    ImU64                   DrawDataPrevContentHash;            // DrawData.ContentHash of the previous frame (when io.ConfigDrawDataHash is set)
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              BackgroundDrawList;                 // First draw list to be rendered.
     ImDrawList              ForegroundDrawList;                 // Last draw list to be rendered. This is where we the render software mouse cursor (if io.MouseDrawCursor is set) and most debug overlays.
@@ -1204,6 +1519,7 @@ struct ImGuiContext
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
+    ImGuiHashStorage                    SettingsWindowsMap;     // Map ImGuiWindowSettings::ID to offset into SettingsWindows[]
 
     // Capture/Logging
     bool                    LogEnabled;
@@ -1216,9 +1532,27 @@ struct ImGuiContext
     int                     LogDepthToExpand;
     int                     LogDepthToExpandDefault;            // Default/stored value for LogDepthMaxExpand if not specified in the LogXXX function call.
 
+    // Input recording/replay
+    ImGuiInputRecorder      InputRecorder;
+
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
+
+    // Memory statistics (see GetMemAllocStats())
+    ImGuiMemAllocStats      MemAllocStats[ImGuiMemAllocTag_COUNT + 1];  // Last entry is the total
+
+    // Memory budget (see io.ConfigMemoryBudget)
+    ImGuiMemoryBudgetStats  MemoryBudgetStats;
+    ImVector<ImGuiWindow*>  MemoryBudgetWindows;                // Temporary buffer: inactive windows sorted by LastTimeActive
+    int                     MemoryBudgetBackoffUsage;           // When != 0: usage left over budget by the last pass which couldn't reclaim enough. Don't try again until usage grows past it.
+
     // Debug Tools
     bool                    DebugItemPickerActive;
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this id
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    int                     DebugDrawVertSaturatedCount;        // Number of ImDrawVert positions clamped to the IMGUI_USE_COMPACT_DRAWVERT range (atomic, see DebugNotifyDrawVertSaturated())
+#endif
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
@@ -1228,6 +1562,8 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024*3+1];               // Temporary text buffer
+    ImLinearArena           FrameArena;                         // Transient allocations which don't outlive the frame, released by NewFrame()
+    int                     FrameAllocationsCount;              // Number of MemAlloc() calls since the start of the frame, see io.MetricsFrameAllocations
 
     ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
     {
@@ -1235,7 +1571,12 @@ struct ImGuiContext
         Font = NULL;
         FontSize = FontBaseSize = 0.0f;
         FontAtlasOwnedByContext = shared_font_atlas ? false : true;
-        IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
+        IO.Fonts = shared_font_atlas;                               // Owned atlas is created by Initialize(), while the context is current
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+        MemAllocFunc = NULL;
+        MemFreeFunc = NULL;
+        MemAllocatorUserData = NULL;
+#endif
         Time = 0.0f;
         FrameCount = 0;
         FrameCountEnded = FrameCountRendered = -1;
@@ -1308,6 +1649,7 @@ struct ImGuiContext
         FocusRequestNextCounterRegular = FocusRequestNextCounterTabStop = INT_MAX;
         FocusTabPressed = false;
 
+        DrawDataPrevContentHash = 0;
         DimBgRatio = 0.0f;
         BackgroundDrawList._OwnerName = "##Background"; // Give it a name for debugging
         ForegroundDrawList._OwnerName = "##Foreground"; // Give it a name for debugging
@@ -1350,14 +1692,20 @@ struct ImGuiContext
         LogDepthRef = 0;
         LogDepthToExpand = LogDepthToExpandDefault = 2;
 
+        MemoryBudgetBackoffUsage = 0;
+
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        DebugDrawVertSaturatedCount = 0;
+#endif
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
         memset(TempBuffer, 0, sizeof(TempBuffer));
+        FrameAllocationsCount = 0;
     }
 };
 
@@ -1416,10 +1764,10 @@ struct IMGUI_API ImGuiWindowTempData
     ImGuiItemFlags          ItemFlags;              // == ItemFlagsStack.back() [empty == ImGuiItemFlags_Default]
     float                   ItemWidth;              // == ItemWidthStack.back(). 0.0: default, >0.0: width in pixels, <0.0: align xx pixels to the right of window
     float                   TextWrapPos;            // == TextWrapPosStack.back() [empty == -1.0f]
-    ImVector<ImGuiItemFlags>ItemFlagsStack;
-    ImVector<float>         ItemWidthStack;
-    ImVector<float>         TextWrapPosStack;
-    ImVector<ImGuiGroupData>GroupStack;
+    ImSmallVector<ImGuiItemFlags, 4> ItemFlagsStack;
+    ImSmallVector<float, 4> ItemWidthStack;
+    ImSmallVector<float, 4> TextWrapPosStack;
+    ImSmallVector<ImGuiGroupData, 4> GroupStack;
     short                   StackSizesBackup[6];    // Store size of various stacks for asserting
 
     ImGuiWindowTempData()
@@ -1458,6 +1806,35 @@ struct IMGUI_API ImGuiWindowTempData
     }
 };
 
+// Copy of the draw list of a window, recorded by End() and reused by following frames submitting the same content hash (see SetNextWindowContentHash()).
+// Begin() still processes and renders decorations (background, title bar, scrollbars...), which must match the cached ones, then skips items.
+// While reusing, End() copies the cached buffers back into the window draw list, translated if the window moved.
+struct ImGuiWindowDrawCache
+{
+    ImGuiID                 ContentHash;        // Content hash submitted for the current frame (0: caching disabled)
+    ImGuiID                 CachedContentHash;  // Content hash of the cached draw list (0: nothing cached)
+    int                     StableFrames;       // Number of consecutive previous frames which submitted the same ContentHash. End() only records after a few.
+    int                     LastFrameActive;    // Frame of the last Begin() updating ContentHash
+    bool                    Replaying;          // Set by Begin() when reusing the cached draw list this frame
+    bool                    HostContained;      // Window rectangle was fully inside the host clipping rectangle, so clip rectangles can be translated
+    ImVec2                  Pos;                // Window position when recording
+    ImVec2                  Size;
+    ImVec2                  Scroll;
+    ImVec2                  ContentSizeRaw;     // DC.CursorMaxPos - DC.CursorStartPos when recording, restored when reusing so ContentSize is unaffected
+    ImVec4                  HostClipRect;
+    ImFont*                 Font;
+    float                   FontSize;
+    int                     BeginCmdCount, BeginIdxCount, BeginVtxCount;    // Size of the draw list at the end of the current frame Begin() (decorations)
+    int                     DecoCmdCount, DecoIdxCount, DecoVtxCount;       // Same, for the cached draw list
+    unsigned int            VtxCurrentIdx;
+    ImVector<ImDrawCmd>     CmdBuffer;
+    ImVector<ImDrawIdx>     IdxBuffer;
+    ImVector<ImDrawVert>    VtxBuffer;
+
+    ImGuiWindowDrawCache()  { ContentHash = CachedContentHash = 0; StableFrames = 0; LastFrameActive = -1; Replaying = HostContained = false; Font = NULL; FontSize = 0.0f; BeginCmdCount = BeginIdxCount = BeginVtxCount = DecoCmdCount = DecoIdxCount = DecoVtxCount = 0; VtxCurrentIdx = 0; }
+    void    ClearFreeMemory()   { CachedContentHash = 0; Replaying = false; CmdBuffer.clear(); IdxBuffer.clear(); VtxBuffer.clear(); }
+};
+
 // Storage for one window
 struct IMGUI_API ImGuiWindow
 {
@@ -1508,7 +1885,7 @@ struct IMGUI_API ImGuiWindow
     ImVec2                  SetWindowPosVal;                    // store window position when using a non-zero Pivot (position set needs to be processed when we know the window size)
     ImVec2                  SetWindowPosPivot;                  // store window pivot for positioning. ImVec2(0,0) when positioning from top-left corner; ImVec2(0.5f,0.5f) for centering; ImVec2(1,1) for bottom right.
 
-    ImVector<ImGuiID>       IDStack;                            // ID stack. ID are hashes seeded with the value at the top of the stack. (In theory this should be in the TempData structure)
+    ImSmallVector<ImGuiID, 8> IDStack;                          // ID stack. ID are hashes seeded with the value at the top of the stack. (In theory this should be in the TempData structure)
     ImGuiWindowTempData     DC;                                 // Temporary per-window data, reset at the beginning of the frame. This used to be called ImGuiDrawContext, hence the "DC" variable name.
 
     // The best way to understand what those rectangles are is to use the 'Metrics -> Tools -> Show windows rectangles' viewer.
@@ -1524,12 +1901,13 @@ struct IMGUI_API ImGuiWindow
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
     float                   ItemWidthDefault;
     ImGuiStorage            StateStorage;
-    ImVector<ImGuiColumns>  ColumnsStorage;
+    ImPool<ImGuiColumns>    ColumnsStorage;
     float                   FontWindowScale;                    // User scale multiplier per-window, via SetWindowFontScale()
     int                     SettingsOffset;                     // Offset into SettingsWindows[] (offsets are always valid as we only grow the array from the back)
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImGuiWindowDrawCache    DrawCache;                          // Retained copy of DrawListInst (see SetNextWindowContentHash())
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window.
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
@@ -1542,6 +1920,8 @@ struct IMGUI_API ImGuiWindow
     bool                    MemoryCompacted;
     int                     MemoryDrawListIdxCapacity;
     int                     MemoryDrawListVtxCapacity;
+    ImGuiHashStorage        StateStorageUsage;                  // Last use of StateStorage entries, when io.ConfigWindowsStorageGcFrames > 0 (see GcMarkStateStorageUsed())
+    float                   StateStorageGcTime;                 // Time of the last GcCompactStateStorage()
 
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
@@ -1550,6 +1930,7 @@ public:
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
+    ImGuiID     GetID(const ImGuiIDLiteral& label);
     ImGuiID     GetIDNoKeepAlive(const char* str, const char* str_end = NULL);
     ImGuiID     GetIDNoKeepAlive(const void* ptr);
     ImGuiID     GetIDNoKeepAlive(int n);
@@ -1736,6 +2117,8 @@ namespace ImGui
     IMGUI_API void          PushMultiItemsWidths(int components, float width_full);
     IMGUI_API void          PushItemFlag(ImGuiItemFlags option, bool enabled);
     IMGUI_API void          PopItemFlag();
+    IMGUI_API const char*   SetNextItemLabelLiteral(const ImGuiIDLiteral& label);  // Let the next widget get its ID from a label hashed at compile-time. Returns label.Str, use IM_LABEL_LITERAL().
+    inline    ImGuiID       GetItemLabelID(ImGuiWindow* window, const char* label) { ImGuiContext& g = *GImGui; if ((g.NextItemData.Flags & ImGuiNextItemDataFlags_HasLabelLiteral) && g.NextItemData.LabelLiteral.Str == label) return window->GetID(g.NextItemData.LabelLiteral); return window->GetID(label); }
     IMGUI_API bool          IsItemToggledSelection();                           // Was the last item selection toggled? (after Selectable(), TreeNode() etc. We only returns toggle _event_ in order to handle clipping correctly)
     IMGUI_API ImVec2        GetContentRegionMaxAbs();
     IMGUI_API void          ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_excess);
@@ -1895,9 +2278,20 @@ namespace ImGui
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
     IMGUI_API void          ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp);
 
+    // Profiler (use via IMGUI_PROFILER_SCOPE() etc. so the calls disappear when IMGUI_ENABLE_PROFILER is not defined)
+    IMGUI_API void          ProfilerBeginScope(const char* name, const char* detail = NULL);  // 'name' must be a static string, 'detail' is copied when recording
+    IMGUI_API void          ProfilerEndScope();
+
+    // Memory statistics (use via IMGUI_MEMALLOC_TAG_SCOPE() so the calls disappear when IMGUI_ENABLE_ALLOC_TRACKING is not defined)
+    IMGUI_API ImGuiMemAllocTag SetMemAllocTag(ImGuiMemAllocTag tag);   // Set subsystem for following allocations made from the calling thread, return previous one
+
     // Garbage collection
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcMarkStateStorageUsed(ImGuiWindow* window, ImGuiID key, int default_val, bool remove_if_default);
+    IMGUI_API int           GcCompactStateStorage(ImGuiWindow* window);
+    IMGUI_API int           GcCalcMemoryUsage();
+    IMGUI_API void          GcEnforceMemoryBudget();
 
     // Debug Tools
     inline void             DebugDrawItemRect(ImU32 col = IM_COL32(255,0,0,255))    { ImGuiContext& g = *GImGui; ImGuiWindow* window = g.CurrentWindow; GetForegroundDrawList(window)->AddRect(window->DC.LastItemRect.Min, window->DC.LastItemRect.Max, col); }
@@ -1943,6 +2337,36 @@ extern void                 ImGuiTestEngineHook_Log(ImGuiContext* ctx, const cha
 #define IMGUI_TEST_ENGINE_LOG(_FMT, ...)                    do { } while (0)
 #endif
 
+// Profiler hooks
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerScope
+{
+    ImGuiProfilerScope(const char* name, const char* detail = NULL) { ImGui::ProfilerBeginScope(name, detail); }
+    ~ImGuiProfilerScope()                                           { ImGui::ProfilerEndScope(); }
+};
+#define IMGUI_PROFILER_SCOPE(_NAME)                         ImGuiProfilerScope imgui_profiler_scope(_NAME)          // Scope ending at the end of the C++ block
+#define IMGUI_PROFILER_BEGIN(_NAME, _DETAIL)                ImGui::ProfilerBeginScope(_NAME, _DETAIL)               // Explicit begin/end, for scopes which don't match a C++ block
+#define IMGUI_PROFILER_END()                                ImGui::ProfilerEndScope()
+#else
+#define IMGUI_PROFILER_SCOPE(_NAME)                         do { } while (0)
+#define IMGUI_PROFILER_BEGIN(_NAME, _DETAIL)                do { } while (0)
+#define IMGUI_PROFILER_END()                                do { } while (0)
+#endif
+
+// Memory allocation tagging
+// Allocations made within the scope are accounted to the given subsystem, innermost scope wins.
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+struct ImGuiMemAllocTagScope
+{
+    ImGuiMemAllocTag        BackupTag;
+    ImGuiMemAllocTagScope(ImGuiMemAllocTag tag)     { BackupTag = ImGui::SetMemAllocTag(tag); }
+    ~ImGuiMemAllocTagScope()                        { ImGui::SetMemAllocTag(BackupTag); }
+};
+#define IMGUI_MEMALLOC_TAG_SCOPE(_TAG)                      ImGuiMemAllocTagScope imgui_memalloc_tag_scope(_TAG)
+#else
+#define IMGUI_MEMALLOC_TAG_SCOPE(_TAG)                      do { } while (0)
+#endif
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #elif defined(__GNUC__)
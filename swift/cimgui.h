@@ -688,7 +688,9 @@ struct ImGuiStyle
     ImVec2 DisplaySafeAreaPadding;
     float MouseCursorScale;
     bool AntiAliasedLines;
+    bool AntiAliasedLinesUseTex;
     bool AntiAliasedFill;
+    bool RoundCornersUseTex;
     float CurveTessellationTol;
     float CircleSegmentMaxError;
     ImVec4 Colors[ImGuiCol_COUNT];
@@ -720,6 +722,9 @@ struct ImGuiIO
     bool ConfigWindowsResizeFromEdges;
     bool ConfigWindowsMoveFromTitleBarOnly;
     float ConfigWindowsMemoryCompactTimer;
+    int ConfigWindowsStorageGcFrames;
+    int ConfigMemoryBudget;
+    bool ConfigDrawDataHash;
     const char* BackendPlatformName;
     const char* BackendRendererName;
     void* BackendPlatformUserData;
@@ -748,12 +753,16 @@ struct ImGuiIO
     bool WantSaveIniSettings;
     bool NavActive;
     bool NavVisible;
+    float NextFrameDelay;
     float Framerate;
     int MetricsRenderVertices;
     int MetricsRenderIndices;
     int MetricsRenderWindows;
     int MetricsActiveWindows;
     int MetricsActiveAllocations;
+    int MetricsFrameAllocations;
+    int MetricsMemoryUsage;
+    int MetricsMemoryReclaimed;
     ImVec2 MouseDelta;
     ImGuiKeyModFlags KeyMods;
     ImVec2 MousePosPrev;
@@ -883,7 +892,10 @@ typedef enum {
     ImDrawListFlags_None = 0,
     ImDrawListFlags_AntiAliasedLines = 1 << 0,
     ImDrawListFlags_AntiAliasedFill = 1 << 1,
-    ImDrawListFlags_AllowVtxOffset = 1 << 2
+    ImDrawListFlags_AllowVtxOffset = 1 << 2,
+    ImDrawListFlags_SharedEdgeLines = 1 << 3,
+    ImDrawListFlags_AntiAliasedLinesUseTex = 1 << 4,
+    ImDrawListFlags_RoundCornersUseTex = 1 << 5
 }ImDrawListFlags_;
 struct ImDrawList
 {
@@ -912,6 +924,8 @@ struct ImDrawData
     ImVec2 DisplayPos;
     ImVec2 DisplaySize;
     ImVec2 FramebufferScale;
+    ImU64 ContentHash;
+    bool ContentUnchanged;
 };
 struct ImFontConfig
 {
@@ -959,11 +973,14 @@ struct ImFontAtlasCustomRect
 typedef enum {
     ImFontAtlasFlags_None = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,
-    ImFontAtlasFlags_NoMouseCursors = 1 << 1
+    ImFontAtlasFlags_NoMouseCursors = 1 << 1,
+    ImFontAtlasFlags_NoBakedLines = 1 << 2,
+    ImFontAtlasFlags_NoBakedRoundCorners = 1 << 3
 }ImFontAtlasFlags_;
 struct ImFontAtlas
 {
     bool Locked;
+    bool LockedForSharing;
     ImFontAtlasFlags Flags;
     ImTextureID TexID;
     int TexDesiredWidth;
@@ -974,10 +991,14 @@ struct ImFontAtlas
     int TexHeight;
     ImVec2 TexUvScale;
     ImVec2 TexUvWhitePixel;
+    ImVec4 TexUvLines[(63) + 1];
+    ImVec4 TexUvRoundCornersFill[(16) + 1];
+    ImVec4 TexUvRoundCornersStroke[(16) + 1];
     ImVector_ImFontPtr Fonts;
     ImVector_ImFontAtlasCustomRect CustomRects;
     ImVector_ImFontConfig ConfigData;
-    int CustomRectIds[1];
+    int CustomRectIds[3];
+    int RefCount;
 };
 struct ImFont
 {